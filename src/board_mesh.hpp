@@ -0,0 +1,69 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <vector>
+
+#include "board_snapshot.hpp"
+
+// Cor de cada CellType, na ordem do enum.
+using CellPalette = std::array<sf::Color, 4>;
+
+// Células de um tabuleiro como um único sf::VertexArray de quads. update()
+// só reescreve as cores das células cujo tipo mudou desde o último snapshot.
+class BoardMesh : public sf::Drawable {
+   public:
+    BoardMesh(Dimension dim, sf::Vector2f origin, float cellSize,
+              float cellPadding, const CellPalette& palette)
+        : palette(palette), vertices(sf::Quads) {
+        width = static_cast<int>(dim.width);
+        height = static_cast<int>(dim.height);
+        vertices.resize(static_cast<size_t>(width) * height * 4);
+        cells.assign(static_cast<size_t>(width) * height, CellType::Water);
+
+        float side = cellSize - cellPadding;
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x) {
+                sf::Vertex* quad = cellQuad(x, y);
+                sf::Vector2f corner(origin.x + x * cellSize,
+                                    origin.y + y * cellSize);
+                quad[0].position = corner;
+                quad[1].position = corner + sf::Vector2f(side, 0);
+                quad[2].position = corner + sf::Vector2f(side, side);
+                quad[3].position = corner + sf::Vector2f(0, side);
+                paint(quad, CellType::Water);
+            }
+    }
+
+    void update(const BoardSnapshot& board) {
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x) {
+                CellType cell = board.get(x, y);
+                CellType& cached = cells[static_cast<size_t>(y) * width + x];
+                if (cell == cached) continue;
+                cached = cell;
+                paint(cellQuad(x, y), cell);
+            }
+    }
+
+   private:
+    void draw(sf::RenderTarget& target,
+              sf::RenderStates states) const override {
+        target.draw(vertices, states);
+    }
+
+    sf::Vertex* cellQuad(int x, int y) {
+        return &vertices[(static_cast<size_t>(y) * width + x) * 4];
+    }
+
+    void paint(sf::Vertex* quad, CellType cell) const {
+        sf::Color color = palette[static_cast<size_t>(cell)];
+        for (int corner = 0; corner < 4; ++corner) quad[corner].color = color;
+    }
+
+    CellPalette palette;
+    sf::VertexArray vertices;
+    std::vector<CellType> cells;
+    int width{};
+    int height{};
+};
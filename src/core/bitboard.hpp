@@ -0,0 +1,310 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry.hpp"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace bitutils {
+
+using Word = std::uint64_t;
+constexpr int WORD_BITS = 64;
+
+inline int popcount(Word word) {
+#if defined(_MSC_VER)
+    return static_cast<int>(__popcnt64(word));
+#else
+    return __builtin_popcountll(word);
+#endif
+}
+
+inline int countTrailingZeros(Word word) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+constexpr int wordsFor(int width) {
+    return (width + WORD_BITS - 1) / WORD_BITS;
+}
+
+// Máscara com os bits [from, to) ligados, com 0 <= from <= to <= 64.
+constexpr Word rangeMask(int from, int to) {
+    if (from >= to) return 0;
+    Word upper = to >= WORD_BITS ? ~Word{0} : (Word{1} << to) - 1;
+    return upper & ~((Word{1} << from) - 1);
+}
+
+// Linhas de várias palavras: out[x] = in[x + shift].
+inline void shiftTowardsStart(const Word* in, Word* out, int words,
+                              int shift) {
+    int wordShift = shift / WORD_BITS;
+    int bitShift = shift % WORD_BITS;
+    for (int w = 0; w < words; ++w) {
+        int src = w + wordShift;
+        Word low = src < words ? in[src] : 0;
+        Word high = src + 1 < words ? in[src + 1] : 0;
+        out[w] = bitShift ? (low >> bitShift) | (high << (WORD_BITS - bitShift))
+                          : low;
+    }
+}
+
+}  // namespace bitutils
+
+// Dimensões definidas em tempo de execução, com as palavras no heap.
+class DynamicBits {
+   public:
+    using Word = bitutils::Word;
+
+    DynamicBits() = default;
+    DynamicBits(int width, int height)
+        : words(static_cast<size_t>(bitutils::wordsFor(width)) * height, 0),
+          boardWidth(width),
+          boardHeight(height),
+          rowWords(bitutils::wordsFor(width)) {}
+
+    int width() const { return boardWidth; }
+    int height() const { return boardHeight; }
+    int wordsPerRow() const { return rowWords; }
+
+    std::vector<Word> words;
+
+   private:
+    int boardWidth{};
+    int boardHeight{};
+    int rowWords{};
+};
+
+// Dimensões constantes e palavras num std::array: sem alocação, e os laços
+// sobre linhas e palavras têm limites conhecidos pelo compilador.
+template <int W, int H>
+class FixedBits {
+   public:
+    using Word = bitutils::Word;
+
+    FixedBits() = default;
+    FixedBits(int width, int height) {
+        if (width != W || height != H)
+            throw std::runtime_error("Dimensão diferente da do tabuleiro fixo");
+    }
+
+    static constexpr int width() { return W; }
+    static constexpr int height() { return H; }
+    static constexpr int wordsPerRow() { return bitutils::wordsFor(W); }
+
+    std::array<Word, static_cast<size_t>(bitutils::wordsFor(W)) * H> words{};
+};
+
+// Dimensões em tempo de execução até MaxW x MaxH, com as palavras num
+// std::array: trivialmente copiável e sem alocação.
+template <int MaxW, int MaxH>
+class BoundedBits {
+   public:
+    using Word = bitutils::Word;
+
+    BoundedBits() = default;
+    BoundedBits(int width, int height)
+        : boardWidth(width),
+          boardHeight(height),
+          rowWords(bitutils::wordsFor(width)) {
+        if (width > MaxW || height > MaxH)
+            throw std::runtime_error("Tabuleiro maior que o limite");
+    }
+
+    int width() const { return boardWidth; }
+    int height() const { return boardHeight; }
+    int wordsPerRow() const { return rowWords; }
+
+    std::array<Word, static_cast<size_t>(bitutils::wordsFor(MaxW)) * MaxH>
+        words{};
+
+   private:
+    int boardWidth{};
+    int boardHeight{};
+    int rowWords{};
+};
+
+// Plano de bits de um tabuleiro. Cada linha começa em uma palavra nova, assim
+// operações sobre linhas e colunas são feitas palavra a palavra. Bits define
+// onde ficam as palavras e se as dimensões são fixas.
+template <typename Bits>
+class BasicBitBoard {
+   public:
+    using Word = bitutils::Word;
+
+    BasicBitBoard() = default;
+    BasicBitBoard(int width, int height) : bits(width, height) {}
+
+    int width() const { return bits.width(); }
+    int height() const { return bits.height(); }
+    int rowWords() const { return bits.wordsPerRow(); }
+    const Word* row(int y) const { return &bits.words[rowOffset(y)]; }
+    Word* row(int y) { return &bits.words[rowOffset(y)]; }
+
+    Dimension dimension() const {
+        return {static_cast<size_t>(bits.width()),
+                static_cast<size_t>(bits.height())};
+    }
+
+    bool operator==(const BasicBitBoard& other) const {
+        return width() == other.width() && height() == other.height() &&
+               bits.words == other.bits.words;
+    }
+    bool operator!=(const BasicBitBoard& other) const {
+        return !(*this == other);
+    }
+
+    bool contains(const Position& pos) const {
+        return pos.x >= 0 && pos.x < bits.width() && pos.y >= 0 &&
+               pos.y < bits.height();
+    }
+
+    bool contains(const Rect& rect) const {
+        return rect.x >= 0 && rect.y >= 0 &&
+               rect.x + rect.width <= bits.width() &&
+               rect.y + rect.height <= bits.height();
+    }
+
+    bool test(const Position& pos) const {
+        return (bits.words[wordIndex(pos)] >> bitIndex(pos.x)) & 1;
+    }
+
+    void set(const Position& pos) {
+        bits.words[wordIndex(pos)] |= Word{1} << bitIndex(pos.x);
+    }
+
+    void reset(const Position& pos) {
+        bits.words[wordIndex(pos)] &= ~(Word{1} << bitIndex(pos.x));
+    }
+
+    void clear() { std::fill(bits.words.begin(), bits.words.end(), 0); }
+
+    bool any() const {
+        for (Word word : bits.words)
+            if (word) return true;
+        return false;
+    }
+
+    int count() const {
+        int total = 0;
+        for (Word word : bits.words) total += bitutils::popcount(word);
+        return total;
+    }
+
+    // Retângulos que saem do tabuleiro são recortados.
+    void setRect(const Rect& rect) {
+        forEachRectWord(
+            rect, [&](size_t index, Word mask) { bits.words[index] |= mask; });
+    }
+
+    void resetRect(const Rect& rect) {
+        forEachRectWord(
+            rect, [&](size_t index, Word mask) { bits.words[index] &= ~mask; });
+    }
+
+    int countInRect(const Rect& rect) const {
+        int total = 0;
+        forEachRectWord(rect, [&](size_t index, Word mask) {
+            total += bitutils::popcount(bits.words[index] & mask);
+        });
+        return total;
+    }
+
+    template <typename Fn>
+    void forEachSet(Fn fn) const {
+        for (int y = 0; y < bits.height(); ++y)
+            for (int w = 0; w < bits.wordsPerRow(); ++w) {
+                Word word = bits.words[rowOffset(y) + w];
+                while (word) {
+                    int x = w * bitutils::WORD_BITS +
+                            bitutils::countTrailingZeros(word);
+                    fn(Position{x, y});
+                    word &= word - 1;
+                }
+            }
+    }
+
+    // Posição do index-ésimo bit ligado, em ordem de linha.
+    Position selectSet(int index) const {
+        for (size_t i = 0; i < bits.words.size(); ++i) {
+            Word word = bits.words[i];
+            int count = bitutils::popcount(word);
+            if (index >= count) {
+                index -= count;
+                continue;
+            }
+            for (; index > 0; --index) word &= word - 1;
+            int x = static_cast<int>(i % bits.wordsPerRow()) *
+                        bitutils::WORD_BITS +
+                    bitutils::countTrailingZeros(word);
+            return {x, static_cast<int>(i / bits.wordsPerRow())};
+        }
+        return {-1, -1};
+    }
+
+    // Posição do index-ésimo bit desligado dentro do tabuleiro.
+    Position selectUnset(int index) const {
+        for (int y = 0; y < bits.height(); ++y)
+            for (int w = 0; w < bits.wordsPerRow(); ++w) {
+                int from = w * bitutils::WORD_BITS;
+                Word inside = bitutils::rangeMask(
+                    0, std::min(bits.width() - from, bitutils::WORD_BITS));
+                Word word = ~bits.words[rowOffset(y) + w] & inside;
+                int count = bitutils::popcount(word);
+                if (index >= count) {
+                    index -= count;
+                    continue;
+                }
+                for (; index > 0; --index) word &= word - 1;
+                return {from + bitutils::countTrailingZeros(word), y};
+            }
+        return {-1, -1};
+    }
+
+   private:
+    size_t rowOffset(int y) const {
+        return static_cast<size_t>(y) * bits.wordsPerRow();
+    }
+
+    size_t wordIndex(const Position& pos) const {
+        return rowOffset(pos.y) + pos.x / bitutils::WORD_BITS;
+    }
+
+    static int bitIndex(int x) { return x % bitutils::WORD_BITS; }
+
+    template <typename Fn>
+    void forEachRectWord(const Rect& rect, Fn fn) const {
+        int fromX = std::max(rect.x, 0);
+        int toX = std::min(rect.x + rect.width, bits.width());
+        int fromY = std::max(rect.y, 0);
+        int toY = std::min(rect.y + rect.height, bits.height());
+        if (fromX >= toX) return;
+        int firstWord = fromX / bitutils::WORD_BITS;
+        int lastWord = (toX - 1) / bitutils::WORD_BITS;
+        for (int w = firstWord; w <= lastWord; ++w) {
+            int wordStart = w * bitutils::WORD_BITS;
+            Word mask = bitutils::rangeMask(std::max(fromX - wordStart, 0),
+                                            std::min(toX - wordStart,
+                                                     bitutils::WORD_BITS));
+            for (int y = fromY; y < toY; ++y) fn(rowOffset(y) + w, mask);
+        }
+    }
+
+    Bits bits;
+};
+
+using BitBoard = BasicBitBoard<DynamicBits>;
+
+template <int W, int H>
+using FixedBitBoard = BasicBitBoard<FixedBits<W, H>>;
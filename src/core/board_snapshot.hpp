@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "grid.hpp"
+
+// Cópia do que a UI mostra de um tabuleiro, um CellType (um byte) por
+// célula. É trivialmente copiável, então a lógica pode publicá-la para outra
+// thread sem compartilhar o Grid.
+struct BoardSnapshot {
+    int width{};
+    int height{};
+    std::array<CellType, Grid::MAX_WIDTH * Grid::MAX_HEIGHT> cells{};
+
+    static BoardSnapshot of(const GridView& view) {
+        Dimension dim = view.dimension();
+        BoardSnapshot snapshot;
+        snapshot.width = static_cast<int>(dim.width);
+        snapshot.height = static_cast<int>(dim.height);
+        for (int y = 0; y < snapshot.height; ++y)
+            for (int x = 0; x < snapshot.width; ++x)
+                snapshot.cells[static_cast<size_t>(y) * snapshot.width + x] =
+                    view.get(x, y);
+        return snapshot;
+    }
+
+    Dimension dimension() const {
+        return {static_cast<size_t>(width), static_cast<size_t>(height)};
+    }
+    CellType get(int x, int y) const {
+        return cells[static_cast<size_t>(y) * width + x];
+    }
+
+    bool operator==(const BoardSnapshot& other) const {
+        return width == other.width && height == other.height &&
+               cells == other.cells;
+    }
+    bool operator!=(const BoardSnapshot& other) const {
+        return !(*this == other);
+    }
+};
@@ -0,0 +1,184 @@
+#include "bot_ai.hpp"
+
+#include <algorithm>
+#include <utility>
+
+template <typename GridType>
+BasicBotAI<GridType>::BasicBotAI(Random& random)
+    : BasicBotAI(random, std::make_unique<BasicRandomSearch<GridType>>()) {}
+
+template <typename GridType>
+BasicBotAI<GridType>::BasicBotAI(
+    Random& random,
+    std::unique_ptr<BasicSearchStrategy<GridType>> searchStrategy)
+    : random(random), searchStrategy(std::move(searchStrategy)) {}
+
+template <typename GridType>
+BasicBotAI<GridType>::~BasicBotAI() { cancelPondering(); }
+
+template <typename GridType>
+Position BasicBotAI<GridType>::computeBotMove(const GridType& grid) {
+    if (pondering.valid()) {
+        Position pos = pondering.get();
+        if (ponderedGrid->attackedCells() == grid.attackedCells()) {
+            beforePondering.reset();
+            return pos;
+        }
+        restoreBeforePondering();
+    }
+    return decideMove(grid);
+}
+
+template <typename GridType>
+void BasicBotAI<GridType>::startPondering(const GridType& grid) {
+    if (pondering.valid() &&
+        ponderedGrid->attackedCells() == grid.attackedCells())
+        return;
+    cancelPondering();
+    ponderedGrid = grid;
+    beforePondering = Snapshot{decision, random};
+    pondering = std::async(std::launch::async,
+                           [this] { return decideMove(*ponderedGrid); });
+}
+
+template <typename GridType>
+void BasicBotAI<GridType>::cancelPondering() {
+    if (!pondering.valid()) return;
+    pondering.wait();
+    pondering = {};
+    restoreBeforePondering();
+}
+
+template <typename GridType>
+bool BasicBotAI<GridType>::waitForPondering(
+    std::chrono::microseconds timeout) const {
+    if (!pondering.valid()) return true;
+    return pondering.wait_for(timeout) == std::future_status::ready;
+}
+
+// O resultado não depende de quando é calculado: tudo o que o bot sabe está
+// no grid e no estado atualizado por onAttackResult.
+template <typename GridType>
+Position BasicBotAI<GridType>::decideMove(const GridType& grid) {
+    switch (decision.state) {
+        case BotState::Searching:
+            return computeSearchingMove(grid);
+        case BotState::Targeting:
+            return computeTargetingMove(grid);
+        case BotState::Finishing:
+            return computeFinishingMove(grid);
+    }
+    return {};
+}
+
+template <typename GridType>
+void BasicBotAI<GridType>::onAttackResult(const Position& pos,
+                                          const AttackResult& result) {
+    if (result.outcome == AttackOutcome::Sunk) {
+        decision.state = BotState::Searching;
+        return;
+    }
+    bool hit = result.outcome == AttackOutcome::Hit;
+    switch (decision.state) {
+        case BotState::Searching:
+            if (!hit) return;
+            decision.state = BotState::Targeting;
+            decision.initialHitPos = pos;
+            decision.remainingDirections = {Direction::Up, Direction::Down,
+                                            Direction::Left, Direction::Right};
+            return;
+        case BotState::Targeting:
+            if (!hit) return;
+            decision.state = BotState::Finishing;
+            decision.lastPos = pos;
+            return;
+        case BotState::Finishing:
+            if (hit)
+                decision.lastPos = pos;
+            else
+                reverseFromInitialHit();
+            return;
+    }
+}
+
+template <typename GridType>
+Position BasicBotAI<GridType>::computeSearchingMove(const GridType& grid) {
+    return searchStrategy->pickSearchCell(grid, random);
+}
+
+template <typename GridType>
+Position BasicBotAI<GridType>::computeTargetingMove(const GridType& grid) {
+    decision.remainingDirections = filterAttackableDirections(
+        grid, decision.initialHitPos, decision.remainingDirections);
+    if (decision.remainingDirections.empty()) {
+        decision.state = BotState::Searching;
+        return computeSearchingMove(grid);
+    }
+    decision.shipDirection = targetDirectionFromRemaining();
+    return incrementToDirection(decision.initialHitPos, decision.shipDirection);
+}
+
+template <typename GridType>
+std::vector<Direction> BasicBotAI<GridType>::filterAttackableDirections(
+    const GridType& grid, const Position& pos,
+    const std::vector<Direction>& directions) const {
+    std::vector<Direction> filtered;
+    for (auto& direction : directions)
+        if (isAttackableCell(grid, incrementToDirection(pos, direction)))
+            filtered.push_back(direction);
+    return filtered;
+}
+
+template <typename GridType>
+Direction BasicBotAI<GridType>::targetDirectionFromRemaining() {
+    std::vector<Direction>& remaining = decision.remainingDirections;
+    std::shuffle(remaining.begin(), remaining.end(), random);
+    Direction direction = remaining.back();
+    remaining.pop_back();
+    return direction;
+}
+
+template <typename GridType>
+Position BasicBotAI<GridType>::incrementToDirection(
+    const Position& pos, const Direction& direction) const {
+    Position newPos = pos;
+    newPos.applyOffset(direction, 1);
+    return newPos;
+}
+
+template <typename GridType>
+bool BasicBotAI<GridType>::isAttackableCell(const GridType& grid,
+                                            const Position& pos) const {
+    return grid.hasCell(pos) && !grid.isAttacked(pos);
+}
+
+// Segue a linha a partir do último acerto. Na borda ou numa célula já
+// atacada, volta ao primeiro acerto e segue no sentido oposto.
+template <typename GridType>
+Position BasicBotAI<GridType>::computeFinishingMove(const GridType& grid) {
+    Position next =
+        incrementToDirection(decision.lastPos, decision.shipDirection);
+    if (isAttackableCell(grid, next)) return next;
+    reverseFromInitialHit();
+    next = incrementToDirection(decision.lastPos, decision.shipDirection);
+    if (isAttackableCell(grid, next)) return next;
+    decision.state = BotState::Searching;
+    return computeSearchingMove(grid);
+}
+
+template <typename GridType>
+void BasicBotAI<GridType>::reverseFromInitialHit() {
+    decision.lastPos = decision.initialHitPos;
+    decision.shipDirection = invertDirection(decision.shipDirection);
+}
+
+template <typename GridType>
+void BasicBotAI<GridType>::restoreBeforePondering() {
+    if (!beforePondering) return;
+    decision = beforePondering->decision;
+    random = beforePondering->random;
+    beforePondering.reset();
+}
+
+template class BasicBotAI<Grid>;
+template class BasicBotAI<LargeGrid>;
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "grid.hpp"
+#include "random.hpp"
+#include "search_strategy.hpp"
+
+// GridType é o grid do adversário, onde o bot atira.
+template <typename GridType>
+class BasicBotAI {
+   public:
+    explicit BasicBotAI(Random& random);
+    BasicBotAI(Random& random,
+               std::unique_ptr<BasicSearchStrategy<GridType>> searchStrategy);
+    // A reflexão roda sobre this, então o bot não é copiado nem movido.
+    BasicBotAI(const BasicBotAI&) = delete;
+    BasicBotAI& operator=(const BasicBotAI&) = delete;
+    ~BasicBotAI();
+
+    // O bot só enxerga o que é público no grid (células atacadas); o que há
+    // na célula escolhida ele descobre pelo resultado do ataque.
+    Position computeBotMove(const GridType& grid);
+    void onAttackResult(const Position& pos, const AttackResult& result);
+
+    // Começa a calcular, numa thread à parte e sobre uma cópia do grid, a
+    // jogada que computeBotMove daria agora. computeBotMove aproveita o
+    // resultado se o grid ainda tiver os mesmos ataques; senão o descarta,
+    // volta o bot ao estado de antes da reflexão e calcula de novo.
+    void startPondering(const GridType& grid);
+    // Espera a tarefa em andamento, se houver, descarta o resultado e desfaz
+    // o que ela mudou no bot. As estratégias não são interrompidas no meio;
+    // a espera é limitada pelo orçamento delas.
+    void cancelPondering();
+    // Espera até timeout pela tarefa em andamento; true se ela terminou. Sem
+    // tarefa, computeBotMove calcula na hora e a resposta é true.
+    bool waitForPondering(std::chrono::microseconds timeout) const;
+
+   private:
+    Position decideMove(const GridType& grid);
+    Position computeSearchingMove(const GridType& grid);
+    Position computeTargetingMove(const GridType& grid);
+    std::vector<Direction> filterAttackableDirections(
+        const GridType& grid, const Position& pos,
+        const std::vector<Direction>& directions) const;
+    Direction targetDirectionFromRemaining();
+    Position incrementToDirection(const Position& pos,
+                                  const Direction& direction) const;
+    bool isAttackableCell(const GridType& grid, const Position& pos) const;
+    Position computeFinishingMove(const GridType& grid);
+    void reverseFromInitialHit();
+    void restoreBeforePondering();
+
+   private:
+    enum class BotState { Searching, Targeting, Finishing };
+
+    // Tudo o que decideMove pode mudar no bot. As estratégias de busca só
+    // guardam o que deduzem do grid, então recalcular sobre outro grid já
+    // as corrige.
+    struct Decision {
+        BotState state = BotState::Searching;
+        Position initialHitPos;
+        Position lastPos;
+        Direction shipDirection;
+        std::vector<Direction> remainingDirections;
+    };
+
+    struct Snapshot {
+        Decision decision;
+        Random random;
+    };
+
+    Random& random;
+    std::unique_ptr<BasicSearchStrategy<GridType>> searchStrategy;
+    Decision decision;
+    std::optional<GridType> ponderedGrid;
+    std::optional<Snapshot> beforePondering;
+    std::future<Position> pondering;
+};
+
+using BotAI = BasicBotAI<Grid>;
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+#include "geometry.hpp"
+enum class CellType : std::uint8_t { Ship, Water, AttackedShip, AttackedWater };
+
+inline CellType attackedVersion(CellType type) {
+    switch (type) {
+        case CellType::Ship:
+            return CellType::AttackedShip;
+        case CellType::Water:
+            return CellType::AttackedWater;
+        default:
+            return type;
+    }
+}
+
+// Uma célula em um byte: o bit 7 marca o ataque e os bits 0-6 guardam o id
+// do navio mais um, com 0 para água.
+namespace cellcode {
+
+using Code = std::uint8_t;
+constexpr Code ATTACKED = 0x80;
+constexpr Code SHIP_MASK = 0x7F;
+
+inline Code ofShip(int shipId) { return static_cast<Code>(shipId + 1); }
+inline int shipId(Code code) { return (code & SHIP_MASK) - 1; }
+inline bool isAttacked(Code code) { return code & ATTACKED; }
+inline bool hasShip(Code code) { return code & SHIP_MASK; }
+
+inline CellType type(Code code) {
+    if (isAttacked(code))
+        return hasShip(code) ? CellType::AttackedShip : CellType::AttackedWater;
+    return hasShip(code) ? CellType::Ship : CellType::Water;
+}
+
+}  // namespace cellcode
+
+// Geometria de um navio posicionado, guardada uma vez por navio; health
+// conta as células ainda não atingidas.
+struct ShipBody {
+    Position initialPos;
+    Direction direction;
+    std::uint8_t size;
+    std::uint8_t health;
+
+    Rect area() const { return lineRect(initialPos, direction, size); }
+    bool isSunk() const { return health == 0; }
+};
@@ -0,0 +1,101 @@
+#include "command_line.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+
+#include "game_defs.hpp"
+#include "grid.hpp"
+#include "tournament.hpp"
+
+bool hasArgument(int argc, char* argv[], std::string_view argument) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) != argument) continue;
+        return true;
+    }
+    return false;
+}
+
+std::optional<int> intArgument(int argc, char* argv[],
+                               std::string_view argument, int minimum,
+                               std::optional<int> fallback) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) != argument) continue;
+        if (i + 1 == argc) return std::nullopt;
+        char* end = nullptr;
+        errno = 0;
+        long value = std::strtol(argv[i + 1], &end, 10);
+        if (end == argv[i + 1] || *end != '\0' || errno == ERANGE ||
+            value < minimum || value > std::numeric_limits<int>::max())
+            return std::nullopt;
+        return static_cast<int>(value);
+    }
+    return fallback;
+}
+
+std::optional<SearchKind> searchArgument(int argc, char* argv[],
+                                         std::string_view argument) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) != argument) continue;
+        if (i + 1 == argc) return std::nullopt;
+        return parseSearchKind(argv[i + 1]);
+    }
+    return SearchKind::Random;
+}
+
+std::optional<std::uint64_t> seedArgument(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) != "--seed") continue;
+        if (i + 1 == argc) return std::nullopt;
+        const char* text = argv[i + 1];
+        char* end = nullptr;
+        errno = 0;
+        std::uint64_t seed = std::strtoull(text, &end, 10);
+        // strtoull aceita "-1" e devolve o valor negado.
+        if (end == text || *end != '\0' || errno == ERANGE ||
+            std::string_view(text).find('-') != std::string_view::npos)
+            return std::nullopt;
+        return seed;
+    }
+    return std::random_device{}();
+}
+
+int runSimulation(int argc, char* argv[]) {
+    int defaultThreads =
+        static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    auto games = intArgument(argc, argv, "--simulate", 1);
+    auto threads = intArgument(argc, argv, "--threads", 1, defaultThreads);
+    auto firstGame = intArgument(argc, argv, "--first-game", 0, 0);
+    auto width = intArgument(argc, argv, "--width", 1, STANDARD_BOARD_WIDTH);
+    auto height =
+        intArgument(argc, argv, "--height", 1, STANDARD_BOARD_HEIGHT);
+    auto ships = intArgument(argc, argv, "--ships", 1, STANDARD_SHIPS_AMOUNT);
+    auto seed = seedArgument(argc, argv);
+    auto playerSearch = searchArgument(argc, argv, "--player-search");
+    auto botSearch = searchArgument(argc, argv, "--bot-search");
+    if (!games || !threads || !firstGame || !width || !height || !ships ||
+        !seed || !playerSearch || !botSearch ||
+        !LargeGrid::fits(*width, *height, *ships)) {
+        std::cerr << "Uso: --simulate N [--threads T] "
+                     "[--player-search random|density|montecarlo|exact] "
+                     "[--bot-search random|density|montecarlo|exact] "
+                     "[--seed S] [--first-game K] [--width W] [--height H] "
+                     "[--ships M]\n"
+                     "N e T são inteiros positivos; K é um inteiro >= 0 e S "
+                     "um inteiro sem sinal.\n"
+                     "O tabuleiro tem no máximo "
+                  << LargeGrid::MAX_WIDTH << "x" << LargeGrid::MAX_HEIGHT
+                  << " células e " << LargeGrid::MAX_SHIPS << " navios.\n";
+        return 1;
+    }
+
+    Tournament tournament({*firstGame, *games, *threads, *width, *height,
+                           *ships, *playerSearch, *botSearch, *seed});
+    printTournamentReport(std::cout, tournament.run());
+    return 0;
+}
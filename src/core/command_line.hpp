@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "search_strategy.hpp"
+
+// Leitura dos argumentos de linha de comando comuns ao jogo e ao naval_sim.
+// Os que recebem valor devolvem nullopt quando o valor falta ou é inválido,
+// para quem chama mostrar o uso.
+
+bool hasArgument(int argc, char* argv[], std::string_view argument);
+// Inteiro >= minimum depois de argument; fallback se argument não aparece e
+// nullopt se o valor falta, tem lixo ou está fora do intervalo.
+std::optional<int> intArgument(int argc, char* argv[],
+                               std::string_view argument, int minimum,
+                               std::optional<int> fallback = std::nullopt);
+// Estratégia depois de argument, ou a aleatória se ele não aparece; nullopt
+// se o valor falta ou não é uma estratégia conhecida.
+std::optional<SearchKind> searchArgument(int argc, char* argv[],
+                                         std::string_view argument);
+// Semente depois de --seed, ou uma aleatória se ele não aparece; nullopt se
+// o valor não é um inteiro sem sinal completo.
+std::optional<std::uint64_t> seedArgument(int argc, char* argv[]);
+
+// Modo --simulate: joga um Tournament e imprime o relatório. O tabuleiro é
+// o padrão, a menos que --width, --height ou --ships digam outro (até o
+// limite do LargeGrid). Devolve o código de saída do processo.
+int runSimulation(int argc, char* argv[]);
@@ -0,0 +1,342 @@
+#include "exact_solver.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include "placement_masks.hpp"
+
+// No tabuleiro padrão a legalidade de cada posicionamento e as suas máscaras
+// saem da tabela gerada em tempo de compilação; nos outros, de cada célula.
+static constexpr const auto& standardMasks =
+    placementMasks<STANDARD_BOARD_WIDTH, STANDARD_BOARD_HEIGHT>;
+
+static bool isStandardBoard(const LayoutObservations& observations) {
+    return observations.width == STANDARD_BOARD_WIDTH &&
+           observations.height == STANDARD_BOARD_HEIGHT;
+}
+
+// Todas as células de area estão ligadas em board, dentro do tabuleiro.
+static bool covers(const LayoutObservations& observations,
+                   const BitBoard& board, const Rect& area) {
+    if (isStandardBoard(observations)) return standardMasks.covers(board, area);
+    int size = std::max(area.width, area.height);
+    return area.x + area.width <= observations.width &&
+           area.y + area.height <= observations.height &&
+           board.countInRect(area) == size;
+}
+
+template <typename Fn>
+void ExactSolver::CellMask::forEachSet(Fn fn) const {
+    for (std::uint64_t word = low; word; word &= word - 1)
+        fn(bitutils::countTrailingZeros(word));
+    for (std::uint64_t word = high; word; word &= word - 1)
+        fn(64 + bitutils::countTrailingZeros(word));
+}
+
+size_t ExactSolver::MemoHash::operator()(const MemoKey& key) const {
+    std::uint64_t hash = static_cast<std::uint64_t>(key.depth);
+    for (std::uint64_t word : {key.free.low, key.free.high, key.uncovered.low,
+                               key.uncovered.high}) {
+        hash = (hash ^ word) * 0x9E3779B97F4A7C15;
+        hash ^= hash >> 29;
+    }
+    return static_cast<size_t>(hash);
+}
+
+ExactSolver::ExactSolver(int threads, std::uint64_t maxNodes)
+    : maxNodes(maxNodes), pool(threads) {}
+
+std::optional<ExactSolver::Solution> ExactSolver::solve(
+    const LayoutObservations& observations, Clock::time_point deadline) {
+    cells = observations.width * observations.height;
+    if (cells > MAX_CELLS) return std::nullopt;
+    this->deadline = deadline;
+
+    sizes = observations.sizes;
+    std::sort(sizes.begin(), sizes.end(), std::greater<int>());
+    Solution solution{1.0, std::vector<double>(cells, 0.0)};
+    if (sizes.empty()) return solution;
+    preparePlacements(observations);
+
+    CellMask free{0, 0};
+    CellMask uncovered{0, 0};
+    observations.freeCells.forEachSet([&](const Position& pos) {
+        free.set(pos.y * observations.width + pos.x);
+    });
+    for (const Position& hit : observations.hits)
+        uncovered.set(hit.y * observations.width + hit.x);
+
+    workers.resize(pool.size());
+    for (auto& worker : workers) {
+        worker.total = {0, std::vector<std::uint64_t>(cells, 0)};
+        worker.byDepth.assign(sizes.size(),
+                              {0, std::vector<std::uint64_t>(cells, 0)});
+        worker.memo.clear();
+        worker.nodes = 0;
+    }
+    nextRoot = 0;
+    nodes = 0;
+    abandoned = false;
+    pool.run([&](int worker) { solveFrom(workers[worker], free, uncovered); });
+    if (abandoned) return std::nullopt;
+
+    // A busca conta frotas ordenadas; navios de mesmo tamanho trocados entre
+    // si dão a mesma frota.
+    std::uint64_t ordered = 0;
+    std::vector<std::uint64_t> coverage(cells, 0);
+    for (const auto& worker : workers) {
+        ordered += worker.total.layouts;
+        for (int cell = 0; cell < cells; ++cell)
+            coverage[cell] += worker.total.coverage[cell];
+    }
+    double permutations = 1.0;
+    for (size_t first = 0, ship = 0; ship < sizes.size(); ++ship) {
+        if (sizes[ship] != sizes[first]) first = ship;
+        permutations *= static_cast<double>(ship - first + 1);
+    }
+
+    solution.layouts = static_cast<double>(ordered) / permutations;
+    if (ordered == 0) return solution;
+    for (int cell = 0; cell < cells; ++cell)
+        solution.probability[cell] = static_cast<double>(coverage[cell]) /
+                                     static_cast<double>(ordered);
+    return solution;
+}
+
+double ExactSolver::layoutBound(const LayoutObservations& observations) {
+    std::vector<int> sizes = observations.sizes;
+    std::sort(sizes.begin(), sizes.end());
+    double bound = 1.0;
+    int fits = 0;
+    int sameSize = 0;
+    for (size_t ship = 0; ship < sizes.size(); ++ship) {
+        // Navios de mesmo tamanho trocados entre si dão a mesma frota.
+        if (ship > 0 && sizes[ship] == sizes[ship - 1]) {
+            bound *= static_cast<double>(fits) / ++sameSize;
+            continue;
+        }
+        sameSize = 1;
+        fits = 0;
+        for (Direction direction : {Direction::Right, Direction::Down}) {
+            if (sizes[ship] == 1 && direction == Direction::Down) break;
+            for (int y = 0; y < observations.height; ++y)
+                for (int x = 0; x < observations.width; ++x) {
+                    Rect area = lineRect({x, y}, direction, sizes[ship]);
+                    if (covers(observations, observations.freeCells, area))
+                        ++fits;
+                }
+        }
+        bound *= fits;
+    }
+    return bound;
+}
+
+// Posicionamentos de um tamanho dentro das células livres observadas. Com
+// hits, ficam de fora os que caem inteiros sobre acertos: um navio todo
+// atingido já estaria afundado.
+std::vector<ExactSolver::Placement> ExactSolver::linePlacements(
+    const LayoutObservations& observations, int size,
+    const BitBoard* hits) const {
+    int width = observations.width;
+    int height = observations.height;
+    std::vector<Placement> placements;
+    for (Direction direction : {Direction::Right, Direction::Down}) {
+        if (size == 1 && direction == Direction::Down) break;
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x) {
+                Rect area = lineRect({x, y}, direction, size);
+                if (!covers(observations, observations.freeCells, area) ||
+                    (hits && covers(observations, *hits, area)))
+                    continue;
+
+                Placement placement{{0, 0}, {0, 0}};
+                if (isStandardBoard(observations)) {
+                    auto masks = standardMasks.rowMasks(area);
+                    for (int cy = area.y; cy < area.y + area.height; ++cy)
+                        placement.footprint.setRow(cy * width,
+                                                   masks.footprint);
+                    for (int cy = standardMasks.haloFrom(area);
+                         cy < standardMasks.haloTo(area); ++cy)
+                        placement.halo.setRow(cy * width, masks.halo);
+                    placements.push_back(placement);
+                    continue;
+                }
+                Rect halo = area.expanded(1);
+                for (int cy = halo.y; cy < halo.y + halo.height; ++cy)
+                    for (int cx = halo.x; cx < halo.x + halo.width; ++cx) {
+                        if (cx < 0 || cy < 0 || cx >= width || cy >= height)
+                            continue;
+                        placement.halo.set(cy * width + cx);
+                        if (area.contains({cx, cy}))
+                            placement.footprint.set(cy * width + cx);
+                    }
+                placements.push_back(placement);
+            }
+    }
+    return placements;
+}
+
+void ExactSolver::preparePlacements(const LayoutObservations& observations) {
+    BitBoard hits(observations.width, observations.height);
+    for (const Position& hit : observations.hits) hits.set(hit);
+
+    std::vector<int> distinctSizes;
+    placementsBySize.clear();
+    for (int size : sizes) {
+        if (!distinctSizes.empty() && distinctSizes.back() == size) continue;
+        distinctSizes.push_back(size);
+        placementsBySize.push_back(linePlacements(observations, size, &hits));
+    }
+    smallestPlacements =
+        linePlacements(observations, sizes.back(), nullptr);
+
+    placementsByDepth.clear();
+    remainingCells.assign(sizes.size() + 1, 0);
+    for (size_t depth = 0; depth < sizes.size(); ++depth) {
+        auto found = std::find(distinctSizes.begin(), distinctSizes.end(),
+                               sizes[depth]);
+        placementsByDepth.push_back(
+            &placementsBySize[found - distinctSizes.begin()]);
+    }
+    for (size_t depth = sizes.size(); depth-- > 0;)
+        remainingCells[depth] = remainingCells[depth + 1] + sizes[depth];
+}
+
+// Os workers disputam os posicionamentos do primeiro navio, um por vez.
+void ExactSolver::solveFrom(Worker& worker, const CellMask& free,
+                            const CellMask& uncovered) {
+    const auto& roots = *placementsByDepth[0];
+    Tally& total = worker.total;
+    for (size_t root = nextRoot++; root < roots.size(); root = nextRoot++) {
+        const Placement& placement = roots[root];
+        CellMask rest = uncovered.without(placement.footprint);
+        if (sizes.size() == 1) {
+            if (rest.any()) continue;
+            ++total.layouts;
+            placement.footprint.forEachSet(
+                [&](int cell) { ++total.coverage[cell]; });
+            continue;
+        }
+
+        if (!countFrom(worker, 1, free.without(placement.halo), rest)) return;
+        const Tally& sub = worker.byDepth[1];
+        if (sub.layouts == 0) continue;
+        total.layouts += sub.layouts;
+        for (int cell = 0; cell < cells; ++cell)
+            total.coverage[cell] += sub.coverage[cell];
+        placement.footprint.forEachSet(
+            [&](int cell) { total.coverage[cell] += sub.layouts; });
+    }
+}
+
+// Preenche worker.byDepth[depth] com as frotas dos navios de depth em diante;
+// false se a busca foi abandonada.
+bool ExactSolver::countFrom(Worker& worker, int depth, const CellMask& free,
+                            const CellMask& uncovered) {
+    Tally& tally = worker.byDepth[depth];
+    tally.layouts = 0;
+    if (uncovered.count() > remainingCells[depth]) return true;
+
+    // Células fora de qualquer posicionamento restante não mudam a contagem;
+    // tirá-las da chave faz subárvores equivalentes caírem na mesma entrada.
+    CellMask live = liveCells(free);
+    if (uncovered.without(live).any()) return true;
+    MemoKey key{depth, {free.low & live.low, free.high & live.high},
+                uncovered};
+    auto cached = worker.memo.find(key);
+    if (cached != worker.memo.end()) {
+        tally = cached->second;
+        return true;
+    }
+    if (shouldStop(worker)) return false;
+
+    std::fill(tally.coverage.begin(), tally.coverage.end(), 0);
+    bool last = depth + 1 == static_cast<int>(sizes.size());
+    for (const Placement& placement : *placementsByDepth[depth]) {
+        if (placement.footprint.without(key.free).any()) continue;
+        CellMask rest = uncovered.without(placement.footprint);
+        if (last) {
+            if (rest.any()) continue;
+            ++tally.layouts;
+            placement.footprint.forEachSet(
+                [&](int cell) { ++tally.coverage[cell]; });
+            continue;
+        }
+
+        if (!countFrom(worker, depth + 1, key.free.without(placement.halo),
+                       rest))
+            return false;
+        const Tally& sub = worker.byDepth[depth + 1];
+        if (sub.layouts == 0) continue;
+        tally.layouts += sub.layouts;
+        for (int cell = 0; cell < cells; ++cell)
+            tally.coverage[cell] += sub.coverage[cell];
+        placement.footprint.forEachSet(
+            [&](int cell) { tally.coverage[cell] += sub.layouts; });
+    }
+
+    if (worker.memo.size() < MAX_MEMO_ENTRIES) worker.memo.emplace(key, tally);
+    return true;
+}
+
+// Todo posicionamento de um navio maior contém um do menor navio restante,
+// então a união dos posicionamentos do menor cobre tudo o que ainda é usável.
+// Aqui entram também os que caem inteiros sobre acertos, que podem ser parte
+// de um navio maior.
+ExactSolver::CellMask ExactSolver::liveCells(const CellMask& free) const {
+    CellMask live{0, 0};
+    for (const Placement& placement : smallestPlacements)
+        if (!placement.footprint.without(free).any()) {
+            live.low |= placement.footprint.low;
+            live.high |= placement.footprint.high;
+        }
+    return live;
+}
+
+bool ExactSolver::shouldStop(Worker& worker) {
+    constexpr std::uint64_t CHECK_INTERVAL = 1024;
+    if (++worker.nodes % CHECK_INTERVAL == 0) {
+        std::uint64_t total = nodes += CHECK_INTERVAL;
+        if (total > maxNodes || Clock::now() > deadline) abandoned = true;
+    }
+    return abandoned.load(std::memory_order_relaxed);
+}
+
+template <typename GridType>
+BasicExactSearch<GridType>::BasicExactSearch(const SearchBudget& budget)
+    : budget(budget), solver(budget.threads, MAX_NODES) {}
+
+template <typename GridType>
+Position BasicExactSearch<GridType>::pickSearchCell(const GridType& grid,
+                                                    Random& random) {
+    if (!ExactSolver::fits(grid)) return fallback.pickSearchCell(grid, random);
+    LayoutObservations observations = observeLayouts(grid);
+    if (ExactSolver::layoutBound(observations) > MAX_LAYOUT_BOUND)
+        return fallback.pickSearchCell(grid, random);
+
+    auto deadline = ExactSolver::Clock::time_point::max();
+    if (budget.time != std::chrono::microseconds::max())
+        deadline = ExactSolver::Clock::now() + budget.time;
+    auto solution = solver.solve(observations, deadline);
+    if (!solution || solution->layouts == 0)
+        return fallback.pickSearchCell(grid, random);
+
+    int width = static_cast<int>(grid.dimension().width);
+    std::vector<Position> best;
+    double bestProbability = 0.0;
+    for (size_t i = 0; i < solution->probability.size(); ++i) {
+        Position pos{static_cast<int>(i) % width, static_cast<int>(i) / width};
+        double probability = solution->probability[i];
+        if (grid.isAttacked(pos) || probability < bestProbability) continue;
+        if (probability > bestProbability) {
+            bestProbability = probability;
+            best.clear();
+        }
+        best.push_back(pos);
+    }
+    if (best.empty()) return fallback.pickSearchCell(grid, random);
+    return best[randomIndex(random, best)];
+}
+
+template class BasicExactSearch<Grid>;
+template class BasicExactSearch<LargeGrid>;
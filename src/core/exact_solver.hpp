@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "bitboard.hpp"
+#include "layout_observations.hpp"
+#include "search_strategy.hpp"
+#include "worker_pool.hpp"
+
+// Conta todas as frotas dos navios não afundados compatíveis com o que já foi
+// visto e devolve a probabilidade exata de cada célula conter navio. Serve
+// para tabuleiros de até 128 células (o 10x10 padrão cabe): cada
+// posicionamento é uma máscara de 128 bits e a busca em profundidade coloca
+// um navio por nível, memorizando o resultado de cada (navios restantes,
+// células livres, acertos ainda não cobertos). Os posicionamentos do primeiro
+// navio são repartidos entre os workers do WorkerPool, cada um com a sua
+// memória. Quando a árvore passa do limite de nós ou do prazo a busca desiste.
+class ExactSolver {
+   public:
+    static constexpr int MAX_CELLS = 128;
+    static constexpr size_t MAX_MEMO_ENTRIES = size_t{1} << 14;
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Solution {
+        // Frotas distintas; navios de mesmo tamanho são intercambiáveis.
+        double layouts;
+        // Por célula, linha a linha.
+        std::vector<double> probability;
+    };
+
+    ExactSolver(int threads, std::uint64_t maxNodes);
+
+    template <typename GridType>
+    static bool fits(const GridType& grid) {
+        Dimension dim = grid.dimension();
+        return dim.width * dim.height <= static_cast<size_t>(MAX_CELLS);
+    }
+
+    // nullopt se o tabuleiro não cabe ou se a busca desistiu.
+    template <typename GridType>
+    std::optional<Solution> solve(
+        const GridType& grid,
+        Clock::time_point deadline = Clock::time_point::max()) {
+        if (!fits(grid)) return std::nullopt;
+        return solve(observeLayouts(grid), deadline);
+    }
+    std::optional<Solution> solve(
+        const LayoutObservations& observations,
+        Clock::time_point deadline = Clock::time_point::max());
+
+    // Cota superior barata do número de frotas: o produto, navio a navio, dos
+    // posicionamentos que cabem nas células livres, ignorando sobreposições.
+    static double layoutBound(const LayoutObservations& observations);
+
+   private:
+    struct CellMask {
+        std::uint64_t low;
+        std::uint64_t high;
+
+        bool any() const { return low | high; }
+        int count() const {
+            return bitutils::popcount(low) + bitutils::popcount(high);
+        }
+        void set(int cell) {
+            (cell < 64 ? low : high) |= std::uint64_t{1} << (cell & 63);
+        }
+        // Liga os bits de uma máscara de linha a partir da célula first.
+        void setRow(int first, std::uint64_t bits) {
+            if (first >= 64) {
+                high |= bits << (first - 64);
+                return;
+            }
+            low |= bits << first;
+            if (first > 0) high |= bits >> (64 - first);
+        }
+        CellMask without(const CellMask& other) const {
+            return {low & ~other.low, high & ~other.high};
+        }
+        bool operator==(const CellMask& other) const {
+            return low == other.low && high == other.high;
+        }
+        template <typename Fn>
+        void forEachSet(Fn fn) const;
+    };
+
+    struct Placement {
+        CellMask footprint;
+        CellMask halo;
+    };
+
+    struct MemoKey {
+        int depth;
+        CellMask free;
+        CellMask uncovered;
+
+        bool operator==(const MemoKey& other) const {
+            return depth == other.depth && free == other.free &&
+                   uncovered == other.uncovered;
+        }
+    };
+
+    struct MemoHash {
+        size_t operator()(const MemoKey& key) const;
+    };
+
+    // Contagem de frotas de uma subárvore e, por célula, em quantas delas a
+    // célula é ocupada por um dos navios colocados na subárvore.
+    struct Tally {
+        std::uint64_t layouts;
+        std::vector<std::uint64_t> coverage;
+    };
+
+    struct Worker {
+        Tally total;
+        std::vector<Tally> byDepth;
+        std::unordered_map<MemoKey, Tally, MemoHash> memo;
+        std::uint64_t nodes;
+    };
+
+    std::vector<Placement> linePlacements(
+        const LayoutObservations& observations, int size,
+        const BitBoard* hits) const;
+    void preparePlacements(const LayoutObservations& observations);
+    void solveFrom(Worker& worker, const CellMask& free,
+                   const CellMask& uncovered);
+    bool countFrom(Worker& worker, int depth, const CellMask& free,
+                   const CellMask& uncovered);
+    CellMask liveCells(const CellMask& free) const;
+    bool shouldStop(Worker& worker);
+
+    int cells{};
+    std::uint64_t maxNodes;
+    WorkerPool pool;
+    std::vector<Worker> workers;
+    // Tamanhos em ordem decrescente e, para cada nível, os posicionamentos
+    // que cabem nas células livres observadas.
+    std::vector<int> sizes;
+    std::vector<const std::vector<Placement>*> placementsByDepth;
+    std::vector<std::vector<Placement>> placementsBySize;
+    std::vector<Placement> smallestPlacements;
+    std::vector<int> remainingCells;
+    std::atomic<size_t> nextRoot{};
+    std::atomic<std::uint64_t> nodes{};
+    std::atomic<bool> abandoned{};
+    Clock::time_point deadline;
+};
+
+// Atira na célula de maior probabilidade exata; enquanto a árvore ainda é
+// grande demais (começo do jogo) usa a DensitySearch. Acima de
+// MAX_LAYOUT_BOUND a busca quase nunca termina dentro de MAX_NODES, então
+// nem é tentada.
+template <typename GridType>
+class BasicExactSearch : public BasicSearchStrategy<GridType> {
+   public:
+    static constexpr std::uint64_t MAX_NODES = 50000;
+    static constexpr double MAX_LAYOUT_BOUND = 1e7;
+
+    explicit BasicExactSearch(const SearchBudget& budget);
+
+    Position pickSearchCell(const GridType& grid, Random& random) override;
+
+   private:
+    SearchBudget budget;
+    ExactSolver solver;
+    BasicDensitySearch<GridType> fallback;
+};
+
+using ExactSearch = BasicExactSearch<Grid>;
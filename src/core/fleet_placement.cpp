@@ -0,0 +1,134 @@
+#include "fleet_placement.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "placement_masks.hpp"
+
+// Tira das células livres o navio e a sua vizinhança. No tabuleiro fixo as
+// máscaras de cada linha vêm da tabela gerada em tempo de compilação.
+static void blockShip(BitBoard& freeCells, const Position& pos,
+                      Direction direction, int size) {
+    freeCells.resetRect(lineRect(pos, direction, size).expanded(1));
+}
+
+template <int W, int H>
+static void blockShip(FixedBitBoard<W, H>& freeCells, const Position& pos,
+                      Direction direction, int size) {
+    placementMasks<W, H>.resetHalo(freeCells, pos, direction, size);
+}
+
+template <typename Board>
+BasicFleetPlacer<Board>::BasicFleetPlacer(int width, int height,
+                                          Random& random, int maxTries)
+    : width(width), height(height), random(random), maxTries(maxTries) {}
+
+template <typename Board>
+std::optional<std::vector<ShipPlacement>> BasicFleetPlacer<Board>::place(
+    const std::vector<int>& shipSizes) {
+    prepare(shipSizes);
+    freeByDepth[0].setRect({0, 0, width, height});
+    return search();
+}
+
+template <typename Board>
+std::optional<std::vector<ShipPlacement>> BasicFleetPlacer<Board>::place(
+    const std::vector<int>& shipSizes, const Board& freeCells) {
+    prepare(shipSizes);
+    freeByDepth[0] = freeCells;
+    return search();
+}
+
+template <typename Board>
+void BasicFleetPlacer<Board>::prepare(const std::vector<int>& shipSizes) {
+    sizes = shipSizes;
+    order.resize(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return sizes[a] > sizes[b]; });
+
+    // Os planos são reaproveitados entre chamadas com a mesma frota.
+    if (freeByDepth.size() != sizes.size() + 1) {
+        Board emptyBoard(width, height);
+        freeByDepth.assign(sizes.size() + 1, emptyBoard);
+        candidatesByDepth.assign(sizes.size(), {emptyBoard, emptyBoard});
+        shifted.resize(emptyBoard.rowWords());
+    }
+    placements.assign(sizes.size(), {});
+    remainingTries = maxTries;
+}
+
+template <typename Board>
+std::optional<std::vector<ShipPlacement>> BasicFleetPlacer<Board>::search() {
+    if (!placeFrom(0)) return std::nullopt;
+    return placements;
+}
+
+template <typename Board>
+bool BasicFleetPlacer<Board>::placeFrom(size_t depth) {
+    if (depth == order.size()) return true;
+    size_t ship = order[depth];
+    int size = sizes[ship];
+    Candidates& candidates = candidatesByDepth[depth];
+    computeStarts(freeByDepth[depth], size, candidates);
+
+    // Navios de tamanho 1 têm o mesmo posicionamento nas duas orientações.
+    int horizontalCount = candidates.horizontal.count();
+    int verticalCount = size > 1 ? candidates.vertical.count() : 0;
+    while (horizontalCount + verticalCount > 0) {
+        if (remainingTries-- <= 0) return false;
+        int pick = random.getInt(horizontalCount + verticalCount - 1);
+        bool horizontal = pick < horizontalCount;
+        Board& starts =
+            horizontal ? candidates.horizontal : candidates.vertical;
+        Position pos =
+            starts.selectSet(horizontal ? pick : pick - horizontalCount);
+        starts.reset(pos);
+        if (horizontal)
+            --horizontalCount;
+        else
+            --verticalCount;
+
+        Direction direction = horizontal ? Direction::Right : Direction::Down;
+        placements[ship] = {pos, direction};
+        Board& nextFree = freeByDepth[depth + 1];
+        nextFree = freeByDepth[depth];
+        blockShip(nextFree, pos, direction, size);
+        if (placeFrom(depth + 1)) return true;
+    }
+    return false;
+}
+
+template <typename Board>
+void BasicFleetPlacer<Board>::computeStarts(const Board& freeCells, int size,
+                                            Candidates& candidates) {
+    // Limites lidos do plano: constantes quando Board tem tamanho fixo.
+    int words = freeCells.rowWords();
+    int rows = freeCells.height();
+    for (int y = 0; y < rows; ++y) {
+        const bitutils::Word* freeRow = freeCells.row(y);
+        bitutils::Word* starts = candidates.horizontal.row(y);
+        std::copy_n(freeRow, words, starts);
+        for (int k = 1; k < size; ++k) {
+            bitutils::shiftTowardsStart(freeRow, shifted.data(), words, k);
+            for (int w = 0; w < words; ++w) starts[w] &= shifted[w];
+        }
+    }
+
+    for (int y = 0; y < rows; ++y) {
+        bitutils::Word* starts = candidates.vertical.row(y);
+        if (y + size > rows) {
+            std::fill_n(starts, words, 0);
+            continue;
+        }
+        std::copy_n(freeCells.row(y), words, starts);
+        for (int k = 1; k < size; ++k) {
+            const bitutils::Word* freeRow = freeCells.row(y + k);
+            for (int w = 0; w < words; ++w) starts[w] &= freeRow[w];
+        }
+    }
+}
+
+template class BasicFleetPlacer<BitBoard>;
+template class BasicFleetPlacer<
+    FixedBitBoard<STANDARD_BOARD_WIDTH, STANDARD_BOARD_HEIGHT>>;
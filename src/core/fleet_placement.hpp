@@ -0,0 +1,67 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "bitboard.hpp"
+#include "game_defs.hpp"
+#include "random.hpp"
+
+struct ShipPlacement {
+    Position pos;
+    Direction direction;
+};
+
+// Posiciona uma frota inteira sem encostar navios. Para cada navio, os
+// posicionamentos legais são calculados de uma vez como planos de bits de
+// início (horizontal e vertical) e sorteados sem reposição; quando um navio
+// não tem candidato, volta aos navios anteriores. O número de tentativas é
+// limitado, então a falha é sempre reportada em tempo previsível.
+// Board é o tipo dos planos de bits: BitBoard para qualquer tamanho ou
+// FixedBitBoard quando o tamanho é conhecido em tempo de compilação, como no
+// Grid padrão, cuja capacidade é o próprio tabuleiro do jogo.
+template <typename Board>
+class BasicFleetPlacer {
+   public:
+    static constexpr int DEFAULT_MAX_TRIES = 10000;
+
+    BasicFleetPlacer(int width, int height, Random& random,
+                     int maxTries = DEFAULT_MAX_TRIES);
+
+    // Posicionamentos na mesma ordem de shipSizes, ou nullopt se não couber.
+    std::optional<std::vector<ShipPlacement>> place(
+        const std::vector<int>& shipSizes);
+    // Como acima, mas os navios só ocupam células ligadas em freeCells.
+    std::optional<std::vector<ShipPlacement>> place(
+        const std::vector<int>& shipSizes, const Board& freeCells);
+
+   private:
+    struct Candidates {
+        Board horizontal;
+        Board vertical;
+    };
+
+    void prepare(const std::vector<int>& shipSizes);
+    std::optional<std::vector<ShipPlacement>> search();
+    bool placeFrom(size_t depth);
+    void computeStarts(const Board& freeCells, int size,
+                       Candidates& candidates);
+
+    int width;
+    int height;
+    Random& random;
+    int maxTries;
+    int remainingTries{};
+    std::vector<int> sizes;
+    std::vector<size_t> order;
+    std::vector<Board> freeByDepth;
+    std::vector<Candidates> candidatesByDepth;
+    std::vector<ShipPlacement> placements;
+    std::vector<bitutils::Word> shifted;
+};
+
+using FleetPlacer = BasicFleetPlacer<BitBoard>;
+
+// Placer do Grid padrão, com os planos de posicionamento em std::array.
+using StandardFleetPlacer = BasicFleetPlacer<
+    FixedBitBoard<STANDARD_BOARD_WIDTH, STANDARD_BOARD_HEIGHT>>;
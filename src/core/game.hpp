@@ -0,0 +1,26 @@
+#pragma once
+
+#include <vector>
+
+#include "game_state.hpp"
+#include "grid.hpp"
+#include "ship.hpp"
+
+template <typename GridType>
+struct BasicGame {
+    BasicGameState<GridType> state;
+    std::vector<Ship> botShips;
+    std::vector<Ship> playerShips;
+    BasicGridView<GridType> playerGridView;
+    BasicGridView<GridType> botGridView;
+    int targetTotalShipSize;
+    int shipsAmount;
+
+    BasicGame(int gridWidth, int gridHeight, int shipsAmount)
+        : state(gridWidth, gridHeight),
+          shipsAmount(shipsAmount),
+          playerGridView(state.grid(GameSide::Player)),
+          botGridView(state.grid(GameSide::Bot)) {}
+};
+
+using Game = BasicGame<Grid>;
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "geometry.hpp"
+
+enum class GameSide { None, Player, Bot };
+enum class MoveParseError { None, InvalidFormat, OutOfBounds };
+
+struct MoveParseResult {
+    Position pos;
+    MoveParseError error;
+};
+
+enum class AttackOutcome { Repeated, Miss, Hit, Sunk };
+
+constexpr int NO_SHIP = -1;
+
+// Tabuleiro padrão do jogo, a frota que se joga nele e quantos navios o Grid
+// dele comporta.
+constexpr int STANDARD_BOARD_WIDTH = 10;
+constexpr int STANDARD_BOARD_HEIGHT = 10;
+constexpr int STANDARD_SHIPS_AMOUNT = 6;
+constexpr int STANDARD_FLEET_CAPACITY = 16;
+
+// Resultado de um ataque; shipId é o navio atingido, ou NO_SHIP.
+struct AttackResult {
+    AttackOutcome outcome;
+    int shipId;
+
+    bool changedCell() const { return outcome != AttackOutcome::Repeated; }
+    bool hitShip() const {
+        return outcome == AttackOutcome::Hit || outcome == AttackOutcome::Sunk;
+    }
+};
@@ -0,0 +1,71 @@
+#include "game_logic.hpp"
+
+#include <utility>
+
+#include "move_representation.hpp"
+
+template <typename GridType>
+BasicGameLogic<GridType>::BasicGameLogic(
+    std::unique_ptr<GameType> game, Random& botRandom,
+    std::unique_ptr<BasicSearchStrategy<GridType>> botSearch)
+    : game(std::move(game)), botAI(botRandom, std::move(botSearch)) {}
+
+template <typename GridType>
+void BasicGameLogic<GridType>::setup(const GameSetup& setup) {
+    botAI.cancelPondering();
+    setup.setupGame(*game);
+    game->state.setTurn(GameSide::Player);
+}
+
+template <typename GridType>
+void BasicGameLogic<GridType>::ponderBotMove() {
+    botAI.startPondering(game->state.grid(GameSide::Player));
+}
+
+template <typename GridType>
+bool BasicGameLogic<GridType>::waitForBotMove(
+    std::chrono::microseconds timeout) const {
+    return botAI.waitForPondering(timeout);
+}
+
+template <typename GridType>
+Position BasicGameLogic<GridType>::botMove() {
+    Position pos = botAI.computeBotMove(game->state.grid(GameSide::Player));
+    MoveDelta delta = game->state.apply(pos);
+    botAI.onAttackResult(pos, delta.result);
+    lastBotMoves.push_back({pos, delta.result});
+    return pos;
+}
+
+template <typename GridType>
+MoveRecord BasicGameLogic<GridType>::playerBotMove(BotType& playerAI) {
+    Position pos = playerAI.computeBotMove(game->state.grid(GameSide::Bot));
+    MoveDelta delta = game->state.apply(pos);
+    playerAI.onAttackResult(pos, delta.result);
+    return {pos, delta.result};
+}
+
+template <typename GridType>
+std::vector<MoveRecord> BasicGameLogic<GridType>::popAllBotMoves() {
+    return std::exchange(lastBotMoves, {});
+}
+
+template <typename GridType>
+AttackResult BasicGameLogic<GridType>::playerMove(const Position& move) {
+    return game->state.apply(move).result;
+}
+
+template <typename GridType>
+bool BasicGameLogic<GridType>::hitBotShipSuccess(const Position& move) {
+    return game->state.grid(GameSide::Bot).isType(move,
+                                                  CellType::AttackedShip);
+}
+
+template <typename GridType>
+std::string BasicGameLogic<GridType>::moveToStrCoordinate(
+    const Position& move) const {
+    return MoveRepresentation::moveToStrCoordinate(move);
+}
+
+template class BasicGameLogic<Grid>;
+template class BasicGameLogic<LargeGrid>;
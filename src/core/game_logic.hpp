@@ -0,0 +1,65 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bot_ai.hpp"
+#include "game.hpp"
+#include "game_defs.hpp"
+#include "game_setup.hpp"
+
+struct MoveRecord {
+    Position pos;
+    AttackResult result;
+};
+
+// Partida com bot: as regras ficam no GameState, aqui só se liga cada
+// jogada ao bot e à fila de jogadas do bot para a UI.
+template <typename GridType>
+class BasicGameLogic {
+   public:
+    using GameType = BasicGame<GridType>;
+    using BotType = BasicBotAI<GridType>;
+
+    // O bot é construído aqui dentro e nunca muda de lugar, pois pode estar
+    // pensando numa thread à parte.
+    BasicGameLogic(std::unique_ptr<GameType> game, Random& botRandom,
+                   std::unique_ptr<BasicSearchStrategy<GridType>> botSearch);
+
+    void setup(const GameSetup& setup);
+
+    const BasicGameState<GridType>& state() const { return game->state; }
+    const BasicGridView<GridType>& playerView() const {
+        return game->playerGridView;
+    }
+    const BasicGridView<GridType>& botView() const {
+        return game->botGridView;
+    }
+
+    bool isGameOver() const { return game->state.isGameOver(); }
+    GameSide winner() const { return game->state.winner(); }
+    GameSide currentTurn() const { return game->state.currentTurn(); }
+
+    // Começa a pensar na próxima jogada do bot enquanto o jogador joga; o
+    // grid do jogador não muda até lá, então botMove responde na hora.
+    void ponderBotMove();
+    // Para a UI não travar: com a reflexão já começada, espera até timeout
+    // pela jogada do bot; true quando botMove pode responder na hora.
+    bool waitForBotMove(std::chrono::microseconds timeout) const;
+    Position botMove();
+    MoveRecord playerBotMove(BotType& playerAI);
+    std::vector<MoveRecord> popAllBotMoves();
+    AttackResult playerMove(const Position& move);
+    bool hitBotShipSuccess(const Position& move);
+
+    std::string moveToStrCoordinate(const Position& move) const;
+
+   private:
+    std::unique_ptr<GameType> game;
+    std::vector<MoveRecord> lastBotMoves;
+    BotType botAI;
+};
+
+using GameLogic = BasicGameLogic<Grid>;
@@ -0,0 +1,87 @@
+#include "game_setup.hpp"
+
+#include <cstdlib>
+#include <stdexcept>
+
+template <typename GridType>
+void GameSetup::setupGame(BasicGame<GridType>& game) const {
+    ShipManager shipManager;
+    game.botShips = selectRandomShips(shipManager, game.shipsAmount);
+    game.playerShips = selectRandomShips(shipManager, game.shipsAmount);
+    game.targetTotalShipSize = calculateTotalShipsSize(game.botShips);
+    equalizeTotalSize(game.playerShips, game.targetTotalShipSize, shipManager);
+    placeFleet(game.state.grid(GameSide::Bot), game.botShips);
+    placeFleet(game.state.grid(GameSide::Player), game.playerShips);
+}
+
+template <typename GridType>
+void GameSetup::placeFleet(GridType& grid,
+                           const std::vector<Ship>& ships) const {
+    std::vector<int> sizes;
+    sizes.reserve(ships.size());
+    for (const auto& ship : ships) sizes.push_back(ship.size);
+
+    auto placements = placeSizes(grid, sizes);
+    if (!placements)
+        throw std::runtime_error("Não foi possível posicionar a frota");
+    for (size_t i = 0; i < ships.size(); ++i)
+        grid.placeShip(ships[i], (*placements)[i].pos,
+                       (*placements)[i].direction);
+}
+
+// O Grid padrão ocupado até a capacidade tem o tamanho conhecido em tempo de
+// compilação, e então os planos de posicionamento também são fixos. Os dois
+// caminhos consomem o Random da mesma forma e produzem o mesmo posicionamento.
+template <typename GridType>
+std::optional<std::vector<ShipPlacement>> GameSetup::placeSizes(
+    const GridType& grid, const std::vector<int>& sizes) const {
+    Dimension dim = grid.dimension();
+    int width = static_cast<int>(dim.width);
+    int height = static_cast<int>(dim.height);
+    if constexpr (GridType::MAX_WIDTH == STANDARD_BOARD_WIDTH &&
+                  GridType::MAX_HEIGHT == STANDARD_BOARD_HEIGHT) {
+        if (width == GridType::MAX_WIDTH && height == GridType::MAX_HEIGHT)
+            return StandardFleetPlacer(width, height, random).place(sizes);
+    }
+    return FleetPlacer(width, height, random).place(sizes);
+}
+
+std::vector<Ship> GameSetup::selectRandomShips(const ShipManager& manager,
+                                               int amount) const {
+    std::vector<Ship> ships;
+    ships.reserve(amount);
+    for (int i = 0; i < amount; ++i)
+        ships.push_back(manager.getRandomShip(random));
+    return ships;
+}
+
+void GameSetup::equalizeTotalSize(std::vector<Ship>& playerShips,
+                                  const int botTotalSize,
+                                  const ShipManager& shipManager) const {
+    int totalDiff = botTotalSize - calculateTotalShipsSize(playerShips);
+    while (totalDiff != 0) {
+        Ship candidate = shipManager.getRandomShip(random);
+        Ship* currentPtr = &playerShips[randomIndex(random, playerShips)];
+        const auto& [bestShip, diffChange] =
+            chooseBestShip(totalDiff, *currentPtr, candidate);
+        totalDiff -= diffChange;
+        *currentPtr = bestShip;
+    }
+}
+
+std::pair<const Ship&, int> GameSetup::chooseBestShip(
+    int& totalDifference, const Ship& current, const Ship& candidate) const {
+    int diffChange = candidate.size - current.size;
+    if (std::abs(totalDifference - diffChange) < std::abs(totalDifference))
+        return {candidate, diffChange};
+    return {current, 0};
+}
+
+int GameSetup::calculateTotalShipsSize(const std::vector<Ship>& ships) const {
+    int total = 0;
+    for (const auto& ship : ships) total += ship.size;
+    return total;
+}
+
+template void GameSetup::setupGame(Game& game) const;
+template void GameSetup::setupGame(BasicGame<LargeGrid>& game) const;
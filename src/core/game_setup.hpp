@@ -0,0 +1,35 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "fleet_placement.hpp"
+#include "game.hpp"
+#include "random.hpp"
+
+class GameSetup {
+   public:
+    explicit GameSetup(Random& random) : random(random) {}
+
+    template <typename GridType>
+    void setupGame(BasicGame<GridType>& game) const;
+
+   private:
+    template <typename GridType>
+    void placeFleet(GridType& grid, const std::vector<Ship>& ships) const;
+    template <typename GridType>
+    std::optional<std::vector<ShipPlacement>> placeSizes(
+        const GridType& grid, const std::vector<int>& sizes) const;
+    std::vector<Ship> selectRandomShips(const ShipManager& manager,
+                                        int amount) const;
+    void equalizeTotalSize(std::vector<Ship>& playerShips,
+                           const int botTotalSize,
+                           const ShipManager& shipManager) const;
+    std::pair<const Ship&, int> chooseBestShip(int& totalDifference,
+                                               const Ship& current,
+                                               const Ship& candidate) const;
+    int calculateTotalShipsSize(const std::vector<Ship>& ships) const;
+
+    Random& random;
+};
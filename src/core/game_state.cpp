@@ -0,0 +1,26 @@
+#include "game_state.hpp"
+
+// Acertar sem afundar mantém a vez; uma jogada repetida não conta.
+template <typename GridType>
+MoveDelta BasicGameState<GridType>::apply(const Position& move) {
+    GameSide attacker = turn;
+    AttackResult result = grid(opponent(attacker)).attack(move);
+    if (result.changedCell() && result.outcome != AttackOutcome::Hit)
+        turn = opponent(attacker);
+    return {attacker, move, result, turn};
+}
+
+template <typename GridType>
+bool BasicGameState<GridType>::isGameOver() const {
+    return botGrid.allShipsAttacked() || playerGrid.allShipsAttacked();
+}
+
+template <typename GridType>
+GameSide BasicGameState<GridType>::winner() const {
+    if (botGrid.allShipsAttacked()) return GameSide::Player;
+    if (playerGrid.allShipsAttacked()) return GameSide::Bot;
+    return GameSide::None;
+}
+
+template class BasicGameState<Grid>;
+template class BasicGameState<LargeGrid>;
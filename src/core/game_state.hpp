@@ -0,0 +1,58 @@
+#pragma once
+
+#include <type_traits>
+
+#include "game_defs.hpp"
+#include "grid.hpp"
+
+// O que um ataque mudou: quem atacou, onde, o resultado e de quem é a vez
+// depois dele.
+struct MoveDelta {
+    GameSide attacker;
+    Position pos;
+    AttackResult result;
+    GameSide nextTurn;
+};
+
+// Estado completo de uma partida: os dois grids e a vez. Não tem ponteiros
+// nem alocação, então clonar é uma cópia de bytes; bots podem simular
+// jogadas numa cópia sem tocar a partida real.
+template <typename GridType>
+class BasicGameState {
+   public:
+    BasicGameState(int width, int height)
+        : playerGrid(width, height), botGrid(width, height) {}
+
+    // Grid com a frota de owner.
+    GridType& grid(GameSide owner) {
+        return owner == GameSide::Bot ? botGrid : playerGrid;
+    }
+    const GridType& grid(GameSide owner) const {
+        return owner == GameSide::Bot ? botGrid : playerGrid;
+    }
+
+    GameSide currentTurn() const { return turn; }
+    void setTurn(GameSide side) { turn = side; }
+
+    // Quem está na vez ataca o grid do adversário.
+    MoveDelta apply(const Position& move);
+
+    bool isGameOver() const;
+    GameSide winner() const;
+
+   private:
+    static GameSide opponent(GameSide side) {
+        return side == GameSide::Player ? GameSide::Bot : GameSide::Player;
+    }
+
+    GridType playerGrid;
+    GridType botGrid;
+    GameSide turn{GameSide::Player};
+};
+
+using GameState = BasicGameState<Grid>;
+using LargeGameState = BasicGameState<LargeGrid>;
+
+static_assert(std::is_trivially_copyable_v<GameState> &&
+                  std::is_trivially_copyable_v<LargeGameState>,
+              "GameState precisa ser clonável por cópia de bytes");
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdlib>
 
 enum class Direction { Right, Down, Left, Up };
 inline Direction invertDirection(const Direction& direction) {
@@ -38,6 +40,31 @@ struct Position {
     }
 };
 
+struct Rect {
+    int x;
+    int y;
+    int width;
+    int height;
+
+    bool contains(const Position& pos) const {
+        return pos.x >= x && pos.x < x + width && pos.y >= y &&
+               pos.y < y + height;
+    }
+
+    Rect expanded(int margin) const {
+        return {x - margin, y - margin, width + 2 * margin,
+                height + 2 * margin};
+    }
+};
+
+inline Rect lineRect(const Position& start, const Direction& direction,
+                     int size) {
+    Position end = start;
+    end.applyOffset(direction, size - 1);
+    return {std::min(start.x, end.x), std::min(start.y, end.y),
+            std::abs(end.x - start.x) + 1, std::abs(end.y - start.y) + 1};
+}
+
 struct Dimension {
     size_t width;
     size_t height;
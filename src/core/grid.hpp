@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+#include "bitboard.hpp"
+#include "cell.hpp"
+#include "game_defs.hpp"
+#include "ship.hpp"
+
+// Cada célula é um byte de cellcode (ataque e id do navio), e a geometria de
+// cada navio fica numa tabela indexada pelo id; um acerto só decrementa a
+// vida desse navio. As células atacadas também são mantidas num plano de
+// bits, para as estratégias de busca trabalharem palavra a palavra.
+// A capacidade (MaxWidth x MaxHeight células e MaxShips navios) é fixada em
+// tempo de compilação e todo o armazenamento é inline, então o grid é
+// trivialmente copiável e do tamanho da capacidade escolhida.
+template <int MaxWidth, int MaxHeight, int MaxShips>
+class BasicGrid {
+   public:
+    static constexpr int MAX_WIDTH = MaxWidth;
+    static constexpr int MAX_HEIGHT = MaxHeight;
+    static constexpr int MAX_SHIPS = MaxShips;
+    static_assert(MaxShips <= cellcode::SHIP_MASK,
+                  "O id do navio precisa caber no cellcode");
+
+    using AttackedBoard = BasicBitBoard<BoundedBits<MaxWidth, MaxHeight>>;
+
+    static constexpr bool fits(int width, int height, int ships) {
+        return width <= MaxWidth && height <= MaxHeight && ships <= MaxShips;
+    }
+
+    BasicGrid(int width, int height)
+        : width(width), height(height), attacked(width, height) {}
+
+    Dimension dimension() const {
+        return {static_cast<size_t>(width), static_cast<size_t>(height)};
+    }
+
+    const bool hasCell(const Position& pos) const {
+        return pos.x >= 0 && pos.x < width && pos.y >= 0 && pos.y < height;
+    }
+
+    CellType cellType(const Position& pos) const {
+        return cellcode::type(cells[cellIndex(pos)]);
+    }
+
+    bool isType(const Position& pos, CellType type) const {
+        return cellType(pos) == type;
+    }
+
+    bool isAttacked(const Position& pos) const {
+        return cellcode::isAttacked(cells[cellIndex(pos)]);
+    }
+
+    const AttackedBoard& attackedCells() const { return attacked; }
+    int shipCount() const { return placedShips; }
+
+    // Retorna o id do navio, que é estável durante o jogo.
+    int placeShip(const Ship& ship, Position pos, Direction direction) {
+        if (placedShips >= MaxShips)
+            throw std::runtime_error("Navios demais para um grid");
+        int id = placedShips;
+        auto size = static_cast<std::uint8_t>(ship.size);
+        ShipBody body{pos, direction, size, size};
+        Rect area = body.area();
+        for (int y = area.y; y < area.y + area.height; ++y)
+            for (int x = area.x; x < area.x + area.width; ++x)
+                cells[cellIndex({x, y})] = cellcode::ofShip(id);
+        shipBodies[placedShips++] = body;
+        return id;
+    }
+
+    AttackResult attack(const Position& pos) {
+        cellcode::Code& code = cells[cellIndex(pos)];
+        if (cellcode::isAttacked(code))
+            return {AttackOutcome::Repeated, NO_SHIP};
+        code |= cellcode::ATTACKED;
+        attacked.set(pos);
+        int id = cellcode::shipId(code);
+        if (id == NO_SHIP) return {AttackOutcome::Miss, NO_SHIP};
+        if (--shipBodies[id].health > 0) return {AttackOutcome::Hit, id};
+        ++sunkShips;
+        return {AttackOutcome::Sunk, id};
+    }
+
+    int shipIdAt(const Position& pos) const {
+        return cellcode::shipId(cells[cellIndex(pos)]);
+    }
+
+    const ShipBody& shipBody(int id) const { return shipBodies[id]; }
+
+    const ShipBody* shipBodyAt(const Position& pos) const {
+        int id = shipIdAt(pos);
+        return id == NO_SHIP ? nullptr : &shipBodies[id];
+    }
+
+    bool allShipsAttacked() const {
+        return sunkShips == placedShips;
+    }
+
+   private:
+    size_t cellIndex(const Position& pos) const {
+        return static_cast<size_t>(pos.y) * width + pos.x;
+    }
+
+    int width;
+    int height;
+    std::array<cellcode::Code, MaxWidth * MaxHeight> cells{};
+    AttackedBoard attacked;
+    std::array<ShipBody, MaxShips> shipBodies{};
+    int placedShips{};
+    int sunkShips{};
+};
+
+// Grid do tabuleiro padrão, o único que a interface mostra.
+using Grid = BasicGrid<STANDARD_BOARD_WIDTH, STANDARD_BOARD_HEIGHT,
+                       STANDARD_FLEET_CAPACITY>;
+// Para torneios em tabuleiros maiores que o padrão.
+using LargeGrid = BasicGrid<128, 128, 64>;
+
+template <typename GridType>
+class BasicGridView {
+   public:
+    explicit BasicGridView(const GridType& grid) : gameGrid(&grid) {}
+    Dimension dimension() const { return gameGrid->dimension(); }
+    CellType get(int x, int y) const { return gameGrid->cellType({x, y}); }
+
+   private:
+    const GridType* gameGrid;
+};
+
+using GridView = BasicGridView<Grid>;
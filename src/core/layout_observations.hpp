@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vector>
+
+#include "bitboard.hpp"
+#include "grid.hpp"
+
+// O que um atirador sabe do grid adversário para deduzir onde estão os
+// navios restantes: células onde ainda cabe navio (não são tiro na água nem
+// vizinhança de navio afundado), acertos em navios ainda não afundados e os
+// tamanhos desses navios.
+struct LayoutObservations {
+    int width;
+    int height;
+    BitBoard freeCells;
+    std::vector<Position> hits;
+    std::vector<int> sizes;
+};
+
+template <typename GridType>
+LayoutObservations observeLayouts(const GridType& grid) {
+    Dimension dim = grid.dimension();
+    int width = static_cast<int>(dim.width);
+    int height = static_cast<int>(dim.height);
+    LayoutObservations observations{
+        width, height, BitBoard(width, height), {}, {}};
+    observations.freeCells.setRect({0, 0, width, height});
+
+    grid.attackedCells().forEachSet([&](const Position& pos) {
+        if (grid.isType(pos, CellType::AttackedWater))
+            observations.freeCells.reset(pos);
+        else if (!grid.shipBodyAt(pos)->isSunk())
+            observations.hits.push_back(pos);
+    });
+    for (int id = 0; id < grid.shipCount(); ++id) {
+        const ShipBody& body = grid.shipBody(id);
+        if (body.isSunk())
+            observations.freeCells.resetRect(body.area().expanded(1));
+        else
+            observations.sizes.push_back(body.size);
+    }
+    return observations;
+}
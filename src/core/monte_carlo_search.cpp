@@ -0,0 +1,132 @@
+#include "monte_carlo_search.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "fleet_placement.hpp"
+
+template <typename GridType>
+BasicMonteCarloSearch<GridType>::BasicMonteCarloSearch(
+    const SearchBudget& budget)
+    : budget(budget), pool(budget.threads) {}
+
+template <typename GridType>
+Position BasicMonteCarloSearch<GridType>::pickSearchCell(const GridType& grid,
+                                                         Random& random) {
+    LayoutObservations observations = observeLayouts(grid);
+    if (observations.sizes.empty())
+        return fallback.pickSearchCell(grid, random);
+
+    // Cada worker tem um fluxo derivado do Random do bot, então com um
+    // orçamento de amostras o resultado só depende da semente.
+    std::uint64_t seed = random();
+    size_t cells =
+        static_cast<size_t>(observations.width) * observations.height;
+    workers.clear();
+    for (int worker = 0; worker < pool.size(); ++worker)
+        workers.push_back({Random::forStream(seed, worker, 0),
+                           std::vector<int>(cells, 0), 0});
+
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    std::vector<int> coverage(cells, 0);
+    int accepted = 0;
+    int drawn = 0;
+    while (true) {
+        pool.run([&](int worker) {
+            sampleRound(observations, workers[worker]);
+        });
+        drawn += ROUND_SAMPLES * pool.size();
+
+        std::fill(coverage.begin(), coverage.end(), 0);
+        accepted = 0;
+        for (const auto& worker : workers) {
+            for (size_t i = 0; i < cells; ++i)
+                coverage[i] += worker.coverage[i];
+            accepted += worker.accepted;
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - start);
+        if (drawn >= budget.samples || elapsed >= budget.time) break;
+        if (hasConverged(grid, coverage, accepted)) break;
+    }
+
+    if (accepted == 0) return fallback.pickSearchCell(grid, random);
+    return pickMostCovered(grid, coverage, random);
+}
+
+template <typename GridType>
+void BasicMonteCarloSearch<GridType>::sampleRound(
+    const LayoutObservations& observations, Worker& worker) const {
+    FleetPlacer placer(observations.width, observations.height, worker.random,
+                       MAX_TRIES_PER_SAMPLE);
+    BitBoard layout(observations.width, observations.height);
+    for (int sample = 0; sample < ROUND_SAMPLES; ++sample) {
+        auto placements =
+            placer.place(observations.sizes, observations.freeCells);
+        if (!placements) continue;
+
+        layout.clear();
+        for (size_t ship = 0; ship < placements->size(); ++ship)
+            layout.setRect(lineRect((*placements)[ship].pos,
+                                    (*placements)[ship].direction,
+                                    observations.sizes[ship]));
+        bool coversHits = std::all_of(
+            observations.hits.begin(), observations.hits.end(),
+            [&](const Position& hit) { return layout.test(hit); });
+        if (!coversHits) continue;
+
+        layout.forEachSet([&](const Position& pos) {
+            ++worker.coverage[static_cast<size_t>(pos.y) * observations.width +
+                              pos.x];
+        });
+        ++worker.accepted;
+    }
+}
+
+// A líder se destaca quando a diferença para a segunda passa de três desvios
+// padrão da contagem das duas.
+template <typename GridType>
+bool BasicMonteCarloSearch<GridType>::hasConverged(
+    const GridType& grid, const std::vector<int>& coverage,
+    int accepted) const {
+    if (accepted < MIN_SAMPLES) return false;
+    int width = static_cast<int>(grid.dimension().width);
+    int best = 0;
+    int second = 0;
+    for (size_t i = 0; i < coverage.size(); ++i) {
+        Position pos{static_cast<int>(i) % width, static_cast<int>(i) / width};
+        if (grid.isAttacked(pos)) continue;
+        if (coverage[i] > best) {
+            second = best;
+            best = coverage[i];
+        } else if (coverage[i] > second) {
+            second = coverage[i];
+        }
+    }
+    return best - second > 3.0 * std::sqrt(static_cast<double>(best + second));
+}
+
+template <typename GridType>
+Position BasicMonteCarloSearch<GridType>::pickMostCovered(
+    const GridType& grid, const std::vector<int>& coverage,
+    Random& random) const {
+    int width = static_cast<int>(grid.dimension().width);
+    std::vector<Position> best;
+    int bestCoverage = -1;
+    for (size_t i = 0; i < coverage.size(); ++i) {
+        Position pos{static_cast<int>(i) % width, static_cast<int>(i) / width};
+        if (grid.isAttacked(pos) || coverage[i] < bestCoverage) continue;
+        if (coverage[i] > bestCoverage) {
+            bestCoverage = coverage[i];
+            best.clear();
+        }
+        best.push_back(pos);
+    }
+    return best[randomIndex(random, best)];
+}
+
+template class BasicMonteCarloSearch<Grid>;
+template class BasicMonteCarloSearch<LargeGrid>;
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <vector>
+
+#include "layout_observations.hpp"
+#include "search_strategy.hpp"
+#include "worker_pool.hpp"
+
+// Amostra frotas completas dos navios não afundados que respeitam tudo o que
+// já foi visto (tiros na água, acertos e navios afundados com a vizinhança) e
+// atira na célula não atacada coberta pelo maior número de amostras. As frotas
+// vêm do mesmo FleetPlacer do GameSetup, em rodadas divididas pelo WorkerPool;
+// a busca para quando o orçamento acaba ou quando a célula líder se destaca da
+// segunda colocada.
+template <typename GridType>
+class BasicMonteCarloSearch : public BasicSearchStrategy<GridType> {
+   public:
+    static constexpr int ROUND_SAMPLES = 64;
+    static constexpr int MIN_SAMPLES = 256;
+    static constexpr int MAX_TRIES_PER_SAMPLE = 200;
+
+    explicit BasicMonteCarloSearch(const SearchBudget& budget);
+
+    Position pickSearchCell(const GridType& grid, Random& random) override;
+
+   private:
+    struct Worker {
+        Random random;
+        std::vector<int> coverage;
+        int accepted;
+    };
+
+    void sampleRound(const LayoutObservations& observations,
+                     Worker& worker) const;
+    bool hasConverged(const GridType& grid, const std::vector<int>& coverage,
+                      int accepted) const;
+    Position pickMostCovered(const GridType& grid,
+                             const std::vector<int>& coverage,
+                             Random& random) const;
+
+    SearchBudget budget;
+    WorkerPool pool;
+    BasicDensitySearch<GridType> fallback;
+    std::vector<Worker> workers;
+};
+
+using MonteCarloSearch = BasicMonteCarloSearch<Grid>;
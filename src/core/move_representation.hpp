@@ -0,0 +1,63 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "game_defs.hpp"
+#include "geometry.hpp"
+
+class MoveRepresentation {
+   public:
+    // Aceita exatamente uma letra maiúscula seguida de um ou dois dígitos.
+    static MoveParseResult parseMove(std::string_view input,
+                                     const Dimension& dimension) {
+        if (input.size() < 2 || input.size() > 3 || !isUpper(input[0]))
+            return {{}, MoveParseError::InvalidFormat};
+
+        int line = 0;
+        for (char c : input.substr(1)) {
+            if (!isDigit(c)) return {{}, MoveParseError::InvalidFormat};
+            line = line * 10 + (c - '0');
+        }
+        int column = input[0] - 'A';
+        line -= 1;
+
+        if (column >= static_cast<int>(dimension.width) || line < 0 ||
+            line >= static_cast<int>(dimension.height))
+            return {{}, MoveParseError::OutOfBounds};
+
+        return {{column, line}, MoveParseError::None};
+    }
+
+    // Interpreta um buffer de jogadas separadas por '\n' em uma única
+    // passada, chamando onMove para cada uma. Linhas vazias são ignoradas e
+    // um '\r' no fim da linha é descartado.
+    template <typename Fn>
+    static void parseMoves(std::string_view buffer, const Dimension& dimension,
+                           Fn&& onMove) {
+        while (!buffer.empty()) {
+            size_t end = buffer.find('\n');
+            std::string_view line = buffer.substr(0, end);
+            buffer.remove_prefix(end == std::string_view::npos ? buffer.size()
+                                                               : end + 1);
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+            if (!line.empty()) onMove(parseMove(line, dimension));
+        }
+    }
+
+    static void parseMoves(std::string_view buffer, const Dimension& dimension,
+                           std::vector<MoveParseResult>& results) {
+        parseMoves(buffer, dimension, [&](const MoveParseResult& result) {
+            results.push_back(result);
+        });
+    }
+
+    static std::string moveToStrCoordinate(const Position& move) {
+        return std::string(1, 'A' + move.x) + std::to_string(move.y + 1);
+    }
+
+   private:
+    static bool isUpper(char c) { return c >= 'A' && c <= 'Z'; }
+    static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+};
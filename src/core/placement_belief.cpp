@@ -0,0 +1,196 @@
+#include "placement_belief.hpp"
+
+#include <algorithm>
+
+PlacementBelief::PlacementBelief(int width, int height,
+                                 const std::vector<int>& shipSizes) {
+    build(width, height, shipSizes);
+}
+
+void PlacementBelief::build(int width, int height,
+                            const std::vector<int>& shipSizes) {
+    this->width = width;
+    this->height = height;
+    this->shipSizes = shipSizes;
+    applied = BitBoard(width, height);
+    groups.clear();
+    placements.clear();
+
+    size_t cells = static_cast<size_t>(width) * height;
+    std::vector<int> sizes = shipSizes;
+    std::sort(sizes.begin(), sizes.end());
+    for (int size : sizes) {
+        if (!groups.empty() && groups.back().size == size) {
+            ++groups.back().remaining;
+            continue;
+        }
+        int group = static_cast<int>(groups.size());
+        groups.push_back({size, 1, std::vector<int>(cells, 0)});
+        for (Direction direction : {Direction::Right, Direction::Down}) {
+            if (size == 1 && direction == Direction::Down) break;
+            for (int y = 0; y < height; ++y)
+                for (int x = 0; x < width; ++x) {
+                    Rect area = lineRect({x, y}, direction, size);
+                    if (area.x + area.width <= width &&
+                        area.y + area.height <= height)
+                        placements.push_back({area, group, true});
+                }
+        }
+    }
+
+    coveringStart.assign(cells + 1, 0);
+    auto forEachCell = [](const Rect& area, auto fn) {
+        for (int y = area.y; y < area.y + area.height; ++y)
+            for (int x = area.x; x < area.x + area.width; ++x) fn(x, y);
+    };
+    for (const Placement& placement : placements)
+        forEachCell(placement.area, [&](int x, int y) {
+            ++coveringStart[cellIndex({x, y}) + 1];
+        });
+    for (size_t cell = 0; cell < cells; ++cell)
+        coveringStart[cell + 1] += coveringStart[cell];
+    covering.resize(coveringStart.back());
+    std::vector<int> next(coveringStart.begin(), coveringStart.end() - 1);
+    for (size_t index = 0; index < placements.size(); ++index)
+        forEachCell(placements[index].area, [&](int x, int y) {
+            covering[next[cellIndex({x, y})]++] = static_cast<int>(index);
+        });
+
+    reset();
+}
+
+void PlacementBelief::reset() {
+    coverage.assign(static_cast<size_t>(width) * height, 0);
+    for (SizeGroup& group : groups) {
+        group.remaining = static_cast<int>(
+            std::count(shipSizes.begin(), shipSizes.end(), group.size));
+        std::fill(group.aliveCover.begin(), group.aliveCover.end(), 0);
+    }
+    for (Placement& placement : placements) {
+        placement.alive = true;
+        SizeGroup& group = groups[placement.group];
+        const Rect& area = placement.area;
+        for (int y = area.y; y < area.y + area.height; ++y)
+            for (int x = area.x; x < area.x + area.width; ++x) {
+                ++group.aliveCover[cellIndex({x, y})];
+                coverage[cellIndex({x, y})] += group.remaining;
+            }
+    }
+    applied.clear();
+    sunkApplied.clear();
+}
+
+void PlacementBelief::applyMiss(const Position& pos) {
+    killCovering({pos.x, pos.y, 1, 1});
+}
+
+void PlacementBelief::applyHit(const Position& pos) {
+    killCovering(Rect{pos.x, pos.y, 1, 1}.expanded(1), &pos);
+}
+
+void PlacementBelief::applySunk(const ShipBody& body) {
+    killCovering(body.area().expanded(1));
+    auto group = std::find_if(groups.begin(), groups.end(), [&](auto& group) {
+        return group.size == body.size;
+    });
+    if (group == groups.end() || group->remaining == 0) return;
+    --group->remaining;
+    for (size_t cell = 0; cell < coverage.size(); ++cell)
+        coverage[cell] -= group->aliveCover[cell];
+}
+
+template <typename GridType>
+void PlacementBelief::sync(const GridType& grid) {
+    Dimension dim = grid.dimension();
+    int gridWidth = static_cast<int>(dim.width);
+    int gridHeight = static_cast<int>(dim.height);
+    size_t ships = static_cast<size_t>(grid.shipCount());
+    bool sameFleet = gridWidth == width && gridHeight == height &&
+                     ships == shipSizes.size();
+    for (size_t id = 0; id < ships && sameFleet; ++id)
+        sameFleet = grid.shipBody(static_cast<int>(id)).size == shipSizes[id];
+    if (!sameFleet) {
+        std::vector<int> sizes;
+        for (size_t id = 0; id < ships; ++id)
+            sizes.push_back(grid.shipBody(static_cast<int>(id)).size);
+        build(gridWidth, gridHeight, sizes);
+    }
+
+    const auto& attacked = grid.attackedCells();
+    bool lostAttacks = false;
+    for (int y = 0; y < height && !lostAttacks; ++y)
+        for (int w = 0; w < applied.rowWords(); ++w)
+            if (applied.row(y)[w] & ~attacked.row(y)[w]) lostAttacks = true;
+    if (lostAttacks) reset();
+    sunkApplied.resize(ships, false);
+
+    for (int y = 0; y < height; ++y)
+        for (int w = 0; w < applied.rowWords(); ++w) {
+            bitutils::Word fresh = attacked.row(y)[w] & ~applied.row(y)[w];
+            for (; fresh; fresh &= fresh - 1) {
+                Position pos{w * bitutils::WORD_BITS +
+                                 bitutils::countTrailingZeros(fresh),
+                             y};
+                if (grid.isType(pos, CellType::AttackedWater))
+                    applyMiss(pos);
+                else
+                    applyHit(pos);
+            }
+            applied.row(y)[w] = attacked.row(y)[w];
+        }
+
+    for (size_t id = 0; id < ships; ++id) {
+        const ShipBody& body = grid.shipBody(static_cast<int>(id));
+        if (sunkApplied[id] || !body.isSunk()) continue;
+        applySunk(body);
+        sunkApplied[id] = true;
+    }
+}
+
+template void PlacementBelief::sync(const Grid& grid);
+template void PlacementBelief::sync(const LargeGrid& grid);
+
+BitBoard PlacementBelief::densest() const {
+    BitBoard best(width, height);
+    int bestCoverage = 1;
+    for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x) {
+            int count = coverage[cellIndex({x, y})];
+            if (count < bestCoverage || applied.test({x, y})) continue;
+            if (count > bestCoverage) {
+                bestCoverage = count;
+                best.clear();
+            }
+            best.set({x, y});
+        }
+    return best;
+}
+
+void PlacementBelief::killCovering(const Rect& cells, const Position* spared) {
+    int fromX = std::max(cells.x, 0);
+    int fromY = std::max(cells.y, 0);
+    int toX = std::min(cells.x + cells.width, width);
+    int toY = std::min(cells.y + cells.height, height);
+    for (int y = fromY; y < toY; ++y)
+        for (int x = fromX; x < toX; ++x) {
+            int cell = cellIndex({x, y});
+            for (int i = coveringStart[cell]; i < coveringStart[cell + 1];
+                 ++i) {
+                Placement& placement = placements[covering[i]];
+                if (placement.alive &&
+                    !(spared && placement.area.contains(*spared)))
+                    kill(placement);
+            }
+        }
+}
+
+void PlacementBelief::kill(Placement& placement) {
+    placement.alive = false;
+    SizeGroup& group = groups[placement.group];
+    const Rect& area = placement.area;
+    for (int y = area.y; y < area.y + area.height; ++y)
+        for (int x = area.x; x < area.x + area.width; ++x) {
+            --group.aliveCover[cellIndex({x, y})];
+            coverage[cellIndex({x, y})] -= group.remaining;
+        }
+}
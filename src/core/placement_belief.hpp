@@ -0,0 +1,75 @@
+#pragma once
+
+#include <vector>
+
+#include "bitboard.hpp"
+#include "grid.hpp"
+
+// Crença de quem procura os navios ainda não encontrados: para cada tamanho
+// da frota, os posicionamentos que ainda são legais, e para cada célula
+// quantos deles a cobrem (contando uma vez por navio restante do tamanho).
+// Cada tiro só visita os posicionamentos que passam pela célula atingida,
+// graças a um índice célula -> posicionamentos montado uma vez, então o custo
+// por tiro é proporcional ao que mudou e não ao tamanho do tabuleiro.
+class PlacementBelief {
+   public:
+    PlacementBelief(int width, int height, const std::vector<int>& shipSizes);
+
+    // Tiro na água: sai todo posicionamento que cobre a célula.
+    void applyMiss(const Position& pos);
+    // Acerto: sai todo posicionamento que toca a célula sem cobri-la, pois
+    // navios não se encostam. Os que a cobrem continuam vivos, já que o
+    // navio atingido segue entre os restantes até afundar.
+    void applyHit(const Position& pos);
+    // Um navio a menos do tamanho de body; saem os posicionamentos que cobrem
+    // ele ou a vizinhança dele.
+    void applySunk(const ShipBody& body);
+    // Aplica o que mudou no grid desde a última chamada. Se o grid tiver
+    // perdido ataques ou mudado de frota (outro jogo), a crença recomeça do
+    // zero, com os navios do grid.
+    template <typename GridType>
+    void sync(const GridType& grid);
+
+    int coverageAt(const Position& pos) const {
+        return coverage[cellIndex(pos)];
+    }
+    // Células ainda não atacadas (até o último sync) de maior cobertura;
+    // vazio se nenhum navio cabe.
+    BitBoard densest() const;
+
+   private:
+    struct Placement {
+        Rect area;
+        int group;
+        bool alive;
+    };
+
+    // Navios de um mesmo tamanho; aliveCover conta, por célula, os
+    // posicionamentos vivos do tamanho que a cobrem.
+    struct SizeGroup {
+        int size;
+        int remaining;
+        std::vector<int> aliveCover;
+    };
+
+    void build(int width, int height, const std::vector<int>& shipSizes);
+    void reset();
+    // Mata os posicionamentos vivos que cobrem alguma célula de cells, menos
+    // os que cobrem spared.
+    void killCovering(const Rect& cells, const Position* spared = nullptr);
+    void kill(Placement& placement);
+    int cellIndex(const Position& pos) const { return pos.y * width + pos.x; }
+
+    int width{};
+    int height{};
+    std::vector<int> shipSizes;
+    std::vector<SizeGroup> groups;
+    std::vector<Placement> placements;
+    // Índice célula -> posicionamentos que a cobrem, em formato compacto:
+    // os da célula c estão em covering[coveringStart[c], coveringStart[c+1]).
+    std::vector<int> coveringStart;
+    std::vector<int> covering;
+    std::vector<int> coverage;
+    BitBoard applied;
+    std::vector<bool> sunkApplied;
+};
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+
+#include "bitboard.hpp"
+
+// Máscaras de linha de cada posicionamento num tabuleiro fixo de até 64
+// colunas (uma palavra por linha), geradas em tempo de compilação. Para cada
+// (tamanho, orientação, coluna) a tabela guarda a pegada do navio e o halo que
+// ele bloqueia; as linhas cobertas dependem só da linha de início. Testar um
+// posicionamento contra um plano é (pegada & ~plano) == 0 nas linhas da
+// pegada, sem percorrer célula por célula.
+template <int W, int H>
+class PlacementMasks {
+   public:
+    using Word = bitutils::Word;
+    static_assert(W > 0 && W <= bitutils::WORD_BITS && H > 0,
+                  "PlacementMasks usa uma palavra por linha");
+    static constexpr int MAX_SIZE = W > H ? W : H;
+
+    struct Masks {
+        Word footprint;
+        Word halo;
+    };
+
+    constexpr PlacementMasks() {
+        for (int x = 0; x < W; ++x) {
+            vertical[x] = {bitutils::rangeMask(x, x + 1),
+                           bitutils::rangeMask(clampX(x - 1), clampX(x + 2))};
+            for (int size = 1; size <= W - x; ++size)
+                horizontal[index(size, x)] = {
+                    bitutils::rangeMask(x, x + size),
+                    bitutils::rangeMask(clampX(x - 1), clampX(x + size + 1))};
+        }
+    }
+
+    // Vazio se o navio sai do tabuleiro.
+    constexpr Masks rowMasks(const Rect& area) const {
+        if (!inside(area)) return {0, 0};
+        return area.height == 1 ? horizontal[index(area.width, area.x)]
+                                : vertical[area.x];
+    }
+
+    // O navio cabe no tabuleiro e todas as células dele estão ligadas em
+    // board (células livres, ou acertos).
+    template <typename Board>
+    bool covers(const Board& board, const Rect& area) const {
+        if (!inside(area)) return false;
+        Word footprint = rowMasks(area).footprint;
+        for (int y = area.y; y < area.y + area.height; ++y)
+            if (footprint & ~board.row(y)[0]) return false;
+        return true;
+    }
+
+    template <typename Board>
+    void resetHalo(Board& board, const Position& pos, Direction direction,
+                   int size) const {
+        Rect area = lineRect(pos, direction, size);
+        Word halo = rowMasks(area).halo;
+        for (int y = haloFrom(area); y < haloTo(area) && halo; ++y)
+            board.row(y)[0] &= ~halo;
+    }
+
+    // Linhas [haloFrom, haloTo) tocadas pelo halo de area.
+    static constexpr int haloFrom(const Rect& area) {
+        return area.y > 0 ? area.y - 1 : 0;
+    }
+    static constexpr int haloTo(const Rect& area) {
+        return area.y + area.height < H ? area.y + area.height + 1 : H;
+    }
+
+   private:
+    static constexpr int index(int size, int x) { return (size - 1) * W + x; }
+    static constexpr int clampX(int x) { return x < 0 ? 0 : (x > W ? W : x); }
+
+    static constexpr bool inside(const Rect& area) {
+        return area.x >= 0 && area.y >= 0 && area.x + area.width <= W &&
+               area.y + area.height <= H && area.width <= MAX_SIZE;
+    }
+
+    std::array<Masks, static_cast<size_t>(MAX_SIZE) * W> horizontal{};
+    std::array<Masks, W> vertical{};
+};
+
+template <int W, int H>
+inline constexpr PlacementMasks<W, H> placementMasks{};
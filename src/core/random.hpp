@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+// Philox4x32-10 (Salmon et al., 2011): função sem estado que embaralha um
+// contador de 128 bits sob uma chave de 64 bits.
+class Philox4x32 {
+   public:
+    using Counter = std::array<std::uint32_t, 4>;
+    using Key = std::array<std::uint32_t, 2>;
+
+    static Counter generate(Counter counter, Key key) {
+        for (int round = 0; round < 10; ++round) {
+            if (round > 0) {
+                key[0] += 0x9E3779B9;
+                key[1] += 0xBB67AE85;
+            }
+            counter = singleRound(counter, key);
+        }
+        return counter;
+    }
+
+   private:
+    static Counter singleRound(const Counter& counter, const Key& key) {
+        std::uint64_t product0 = std::uint64_t{0xD2511F53} * counter[0];
+        std::uint64_t product1 = std::uint64_t{0xCD9E8D57} * counter[2];
+        return {high(product1) ^ counter[1] ^ key[0], low(product1),
+                high(product0) ^ counter[3] ^ key[1], low(product0)};
+    }
+
+    static std::uint32_t high(std::uint64_t x) {
+        return static_cast<std::uint32_t>(x >> 32);
+    }
+    static std::uint32_t low(std::uint64_t x) {
+        return static_cast<std::uint32_t>(x);
+    }
+};
+
+// Gerador xoshiro256** com semente explícita. Cada dono (jogo, thread de
+// simulação) tem a sua instância e a repassa por referência a quem sorteia.
+class Random {
+   public:
+    using result_type = std::uint64_t;
+
+    explicit Random(std::uint64_t seed) {
+        for (auto& word : state) word = splitMix64(seed);
+    }
+
+    // Fluxo determinado só por (semente mestre, índice, consumidor): o estado
+    // inicial vem do Philox aplicado a esse contador, então o mesmo fluxo é
+    // reproduzido em qualquer thread ou processo.
+    static Random forStream(std::uint64_t masterSeed, std::uint64_t index,
+                            std::uint32_t consumer) {
+        Philox4x32::Key key{static_cast<std::uint32_t>(masterSeed),
+                            static_cast<std::uint32_t>(masterSeed >> 32)};
+        Random random(0);
+        for (std::uint32_t block = 0; block < 2; ++block) {
+            auto words = Philox4x32::generate(
+                {static_cast<std::uint32_t>(index),
+                 static_cast<std::uint32_t>(index >> 32), consumer, block},
+                key);
+            random.state[block * 2] =
+                (std::uint64_t{words[0]} << 32) | words[1];
+            random.state[block * 2 + 1] =
+                (std::uint64_t{words[2]} << 32) | words[3];
+        }
+        return random;
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() {
+        const std::uint64_t result = rotl(state[1] * 5, 7) * 9;
+        const std::uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+
+    // Inteiro uniforme em [0, max].
+    int getInt(int max) {
+        if (max <= 0) return 0;
+        return static_cast<int>(bounded(static_cast<std::uint32_t>(max) + 1));
+    }
+
+    // Inteiro uniforme em [min, max].
+    int getInt(int min, int max) { return min + getInt(max - min); }
+
+   private:
+    // Redução por multiplicação de Lemire, sem viés e quase sem divisões.
+    std::uint32_t bounded(std::uint32_t range) {
+        std::uint64_t product = next32() * std::uint64_t{range};
+        auto low = static_cast<std::uint32_t>(product);
+        if (low < range) {
+            std::uint32_t threshold = (0u - range) % range;
+            while (low < threshold) {
+                product = next32() * std::uint64_t{range};
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+
+    std::uint64_t next32() { return (*this)() >> 32; }
+
+    static std::uint64_t rotl(std::uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    static std::uint64_t splitMix64(std::uint64_t& seed) {
+        std::uint64_t z = (seed += 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+
+    std::array<std::uint64_t, 4> state;
+};
+
+template <typename Container>
+int randomIndex(Random& random, const Container& container) {
+    if (container.empty()) throw std::runtime_error("Container is empty");
+    return random.getInt(static_cast<int>(container.size()) - 1);
+}
@@ -0,0 +1,85 @@
+#include "search_strategy.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "exact_solver.hpp"
+#include "monte_carlo_search.hpp"
+
+SearchBudget SearchBudget::interactive() {
+    int cores = static_cast<int>(std::thread::hardware_concurrency());
+    return {std::chrono::milliseconds(8), std::numeric_limits<int>::max(),
+            std::clamp(cores, 1, 4)};
+}
+
+SearchBudget SearchBudget::fixedSamples(int samples) {
+    return {std::chrono::microseconds::max(), samples, 1};
+}
+
+// Sorteia o índice entre as células não atacadas e o localiza com
+// popcount, sem depender de quantas já foram atacadas.
+template <typename GridType>
+Position BasicRandomSearch<GridType>::pickSearchCell(const GridType& grid,
+                                                     Random& random) {
+    const auto& attacked = grid.attackedCells();
+    Dimension dim = grid.dimension();
+    int freeCells = static_cast<int>(dim.width * dim.height) - attacked.count();
+    if (freeCells <= 0)
+        throw std::runtime_error("Não há células livres para atacar");
+    return attacked.selectUnset(random.getInt(freeCells - 1));
+}
+
+template <typename GridType>
+Position BasicDensitySearch<GridType>::pickSearchCell(const GridType& grid,
+                                                      Random& random) {
+    if (!belief) {
+        std::vector<int> shipSizes;
+        for (int id = 0; id < grid.shipCount(); ++id)
+            shipSizes.push_back(grid.shipBody(id).size);
+        Dimension dim = grid.dimension();
+        belief = std::make_unique<PlacementBelief>(
+            static_cast<int>(dim.width), static_cast<int>(dim.height),
+            shipSizes);
+    }
+
+    belief->sync(grid);
+    BitBoard best = belief->densest();
+    if (!best.any()) return fallback.pickSearchCell(grid, random);
+    return best.selectSet(random.getInt(best.count() - 1));
+}
+
+template <typename GridType>
+std::unique_ptr<BasicSearchStrategy<GridType>> makeSearchStrategy(
+    SearchKind kind, const SearchBudget& budget) {
+    switch (kind) {
+        case SearchKind::Density:
+            return std::make_unique<BasicDensitySearch<GridType>>();
+        case SearchKind::MonteCarlo:
+            return std::make_unique<BasicMonteCarloSearch<GridType>>(budget);
+        case SearchKind::Exact:
+            return std::make_unique<BasicExactSearch<GridType>>(budget);
+        case SearchKind::Random:
+            break;
+    }
+    return std::make_unique<BasicRandomSearch<GridType>>();
+}
+
+template class BasicRandomSearch<Grid>;
+template class BasicRandomSearch<LargeGrid>;
+template class BasicDensitySearch<Grid>;
+template class BasicDensitySearch<LargeGrid>;
+template std::unique_ptr<BasicSearchStrategy<Grid>> makeSearchStrategy(
+    SearchKind kind, const SearchBudget& budget);
+template std::unique_ptr<BasicSearchStrategy<LargeGrid>> makeSearchStrategy(
+    SearchKind kind, const SearchBudget& budget);
+
+std::optional<SearchKind> parseSearchKind(std::string_view name) {
+    if (name == "random") return SearchKind::Random;
+    if (name == "density") return SearchKind::Density;
+    if (name == "montecarlo") return SearchKind::MonteCarlo;
+    if (name == "exact") return SearchKind::Exact;
+    return std::nullopt;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include "grid.hpp"
+#include "placement_belief.hpp"
+#include "random.hpp"
+
+enum class SearchKind { Random, Density, MonteCarlo, Exact };
+
+// Orçamento das estratégias que amostram. No jogo interativo o limite é o
+// tempo por jogada; nos torneios é um número fixo de amostras numa só thread,
+// para que a partida dependa só da semente.
+struct SearchBudget {
+    std::chrono::microseconds time;
+    int samples;
+    int threads;
+
+    static SearchBudget interactive();
+    static SearchBudget fixedSamples(int samples);
+};
+
+// Escolhe o próximo tiro enquanto o BotAI não tem um navio em vista.
+// GridType é o grid do adversário; as estratégias são instanciadas para o
+// Grid padrão e para o LargeGrid.
+template <typename GridType>
+class BasicSearchStrategy {
+   public:
+    virtual ~BasicSearchStrategy() = default;
+    virtual Position pickSearchCell(const GridType& grid, Random& random) = 0;
+};
+
+template <typename GridType>
+class BasicRandomSearch : public BasicSearchStrategy<GridType> {
+   public:
+    Position pickSearchCell(const GridType& grid, Random& random) override;
+};
+
+// Atira na célula coberta pelo maior número de posicionamentos possíveis dos
+// navios ainda não afundados. A PlacementBelief é mantida entre jogadas e só
+// recebe os tiros novos.
+template <typename GridType>
+class BasicDensitySearch : public BasicSearchStrategy<GridType> {
+   public:
+    Position pickSearchCell(const GridType& grid, Random& random) override;
+
+   private:
+    BasicRandomSearch<GridType> fallback;
+    std::unique_ptr<PlacementBelief> belief;
+};
+
+using SearchStrategy = BasicSearchStrategy<Grid>;
+using RandomSearch = BasicRandomSearch<Grid>;
+using DensitySearch = BasicDensitySearch<Grid>;
+
+template <typename GridType = Grid>
+std::unique_ptr<BasicSearchStrategy<GridType>> makeSearchStrategy(
+    SearchKind kind, const SearchBudget& budget = SearchBudget::interactive());
+std::optional<SearchKind> parseSearchKind(std::string_view name);
@@ -3,7 +3,7 @@
 #include <array>
 #include <string>
 
-#include "utils.hpp"
+#include "random.hpp"
 
 struct Ship {
     std::string name;
@@ -20,7 +20,9 @@ class ShipManager {
                   {"Destroyer", 2}}};
     }
 
-    Ship getRandomShip() const { return ships[randomIndex(ships)]; }
+    Ship getRandomShip(Random& random) const {
+        return ships[randomIndex(random, ships)];
+    }
 
    private:
     std::array<Ship, 5> ships;
@@ -0,0 +1,155 @@
+#include "tournament.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include "bot_ai.hpp"
+#include "game.hpp"
+#include "game_logic.hpp"
+#include "game_setup.hpp"
+
+void TournamentReport::add(const GameRecord& record) {
+    ++games;
+    if (record.winner == GameSide::Player)
+        ++playerWins;
+    else if (record.winner == GameSide::Bot)
+        ++botWins;
+    shotsToWin.push_back(record.winnerShots);
+}
+
+void TournamentReport::merge(const TournamentReport& other) {
+    games += other.games;
+    playerWins += other.playerWins;
+    botWins += other.botWins;
+    failedSetups += other.failedSetups;
+    shotsToWin.insert(shotsToWin.end(), other.shotsToWin.begin(),
+                      other.shotsToWin.end());
+}
+
+double TournamentReport::gamesPerSecond() const {
+    return elapsedSeconds > 0 ? games / elapsedSeconds : 0;
+}
+
+TournamentReport Tournament::run() const {
+    if (!LargeGrid::fits(config.gridWidth, config.gridHeight,
+                         config.shipsAmount))
+        throw std::runtime_error("Tabuleiro maior que o limite do torneio");
+    int threads = std::max(1, std::min(config.threads, config.games));
+    std::vector<TournamentReport> partials(threads);
+    std::atomic<int> nextGame{0};
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (auto& partial : partials)
+        workers.emplace_back([&] { runWorker(nextGame, partial); });
+    for (auto& worker : workers) worker.join();
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    TournamentReport report;
+    for (const auto& partial : partials) report.merge(partial);
+    report.threads = threads;
+    report.elapsedSeconds = elapsed.count();
+    std::sort(report.shotsToWin.begin(), report.shotsToWin.end());
+    return report;
+}
+
+void Tournament::runWorker(std::atomic<int>& nextGame,
+                           TournamentReport& report) const {
+    for (int game = nextGame.fetch_add(1, std::memory_order_relaxed);
+         game < config.games;
+         game = nextGame.fetch_add(1, std::memory_order_relaxed)) {
+        auto record = playGame(config.firstGame + game);
+        if (record)
+            report.add(*record);
+        else
+            ++report.failedSetups;
+    }
+}
+
+std::optional<GameRecord> Tournament::playGame(int gameIndex) const {
+    if (Grid::fits(config.gridWidth, config.gridHeight, config.shipsAmount))
+        return playGameOn<Grid>(gameIndex);
+    return playGameOn<LargeGrid>(gameIndex);
+}
+
+template <typename GridType>
+std::optional<GameRecord> Tournament::playGameOn(int gameIndex) const {
+    auto stream = [&](RandomConsumer consumer) {
+        return Random::forStream(config.seed, gameIndex,
+                                 static_cast<std::uint32_t>(consumer));
+    };
+    SearchBudget searchBudget = SearchBudget::fixedSamples(SEARCH_SAMPLES);
+    Random setupRandom = stream(RandomConsumer::Setup);
+    Random playerRandom = stream(RandomConsumer::PlayerBot);
+    Random botRandom = stream(RandomConsumer::Bot);
+
+    auto game = std::make_unique<BasicGame<GridType>>(
+        config.gridWidth, config.gridHeight, config.shipsAmount);
+    BasicGameLogic<GridType> logic(
+        std::move(game), botRandom,
+        makeSearchStrategy<GridType>(config.botSearch, searchBudget));
+    GameSetup setup(setupRandom);
+    // Uma exceção escapando da thread do worker derrubaria o processo.
+    try {
+        logic.setup(setup);
+    } catch (const std::runtime_error&) {
+        return std::nullopt;
+    }
+
+    BasicBotAI<GridType> playerAI(
+        playerRandom,
+        makeSearchStrategy<GridType>(config.playerSearch, searchBudget));
+    int playerShots = 0;
+    int botShots = 0;
+    while (!logic.isGameOver()) {
+        if (logic.currentTurn() == GameSide::Player) {
+            logic.playerBotMove(playerAI);
+            ++playerShots;
+        } else {
+            logic.botMove();
+            ++botShots;
+        }
+    }
+    GameSide winner = logic.winner();
+    return GameRecord{winner,
+                      winner == GameSide::Player ? playerShots : botShots};
+}
+
+static int percentile(const std::vector<int>& sorted, int percent) {
+    if (sorted.empty()) return 0;
+    size_t index = (sorted.size() - 1) * percent / 100;
+    return sorted[index];
+}
+
+void printTournamentReport(std::ostream& out, const TournamentReport& report) {
+    auto rate = [&](int wins) {
+        return report.games ? 100.0 * wins / report.games : 0.0;
+    };
+    double shotsSum = 0;
+    for (int shots : report.shotsToWin) shotsSum += shots;
+    double shotsMean =
+        report.shotsToWin.empty() ? 0 : shotsSum / report.shotsToWin.size();
+
+    out << "==========Torneio de bots==========\n";
+    out << "Partidas: " << report.games << " em " << report.threads
+        << " threads\n";
+    out << "Vitórias do jogador: " << report.playerWins << " ("
+        << rate(report.playerWins) << "%)\n";
+    out << "Vitórias do bot: " << report.botWins << " ("
+        << rate(report.botWins) << "%)\n";
+    if (report.failedSetups > 0)
+        out << "Partidas sem posicionamento possível: " << report.failedSetups
+            << "\n";
+    out << "Tiros até a vitória: média " << shotsMean << ", mín "
+        << percentile(report.shotsToWin, 0) << ", p50 "
+        << percentile(report.shotsToWin, 50) << ", p90 "
+        << percentile(report.shotsToWin, 90) << ", máx "
+        << percentile(report.shotsToWin, 100) << "\n";
+    out << "Tempo: " << report.elapsedSeconds << " s ("
+        << report.gamesPerSecond() << " partidas/s)\n";
+}
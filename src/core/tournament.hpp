@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <vector>
+
+#include "game_defs.hpp"
+#include "random.hpp"
+#include "search_strategy.hpp"
+
+// Consumidores de aleatoriedade de uma partida; cada um tem o seu fluxo.
+enum class RandomConsumer : std::uint32_t { Setup, PlayerBot, Bot };
+
+struct TournamentConfig {
+    int firstGame;
+    int games;
+    int threads;
+    int gridWidth;
+    int gridHeight;
+    int shipsAmount;
+    SearchKind playerSearch;
+    SearchKind botSearch;
+    std::uint64_t seed;
+};
+
+struct GameRecord {
+    GameSide winner;
+    int winnerShots;
+};
+
+struct TournamentReport {
+    int games{};
+    int threads{};
+    int playerWins{};
+    int botWins{};
+    // Partidas descartadas porque a frota sorteada não coube no tabuleiro.
+    int failedSetups{};
+    std::vector<int> shotsToWin;
+    double elapsedSeconds{};
+
+    void add(const GameRecord& record);
+    void merge(const TournamentReport& other);
+    double gamesPerSecond() const;
+};
+
+// Joga partidas de BotAI contra BotAI sem interface, cada lado com a sua
+// estratégia de busca. Cada partida tem o seu próprio Game, GameLogic e
+// geradores; a partida k sempre usa os mesmos fluxos aleatórios, derivados
+// da semente e de k, não importa qual thread a jogue. Os resultados só são
+// juntados no final. O tabuleiro padrão usa o Grid; tamanhos maiores, o
+// LargeGrid. Uma partida cuja frota não coube no tabuleiro não é jogada e só
+// entra na contagem de failedSetups.
+class Tournament {
+   public:
+    // Amostras por jogada das estratégias que amostram: orçamento fixo para
+    // a partida ser reprodutível.
+    static constexpr int SEARCH_SAMPLES = 1024;
+
+    explicit Tournament(const TournamentConfig& config) : config(config) {}
+
+    TournamentReport run() const;
+
+   private:
+    void runWorker(std::atomic<int>& nextGame, TournamentReport& report) const;
+    std::optional<GameRecord> playGame(int gameIndex) const;
+    template <typename GridType>
+    std::optional<GameRecord> playGameOn(int gameIndex) const;
+
+    TournamentConfig config;
+};
+
+void printTournamentReport(std::ostream& out, const TournamentReport& report);
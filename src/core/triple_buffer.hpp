@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Passa valores de uma thread que escreve para uma que lê sem travas e sem
+// que uma espere a outra. Há três cópias: a que o escritor preenche, a que o
+// leitor está usando e, entre as duas, a mais nova já publicada. publish() e
+// update() só trocam índices com a do meio, então o leitor sempre pega o
+// valor mais recente e os intermediários são descartados.
+template <typename T>
+class TripleBuffer {
+   public:
+    // Escritor: a cópia a preencher antes de publish().
+    T& writeSlot() { return slots[back]; }
+    void publish() {
+        std::uint8_t previous = middle.exchange(
+            static_cast<std::uint8_t>(back | FRESH), std::memory_order_acq_rel);
+        back = previous & INDEX_MASK;
+    }
+
+    // Leitor: troca para a cópia mais nova; false se nada foi publicado desde
+    // a última troca.
+    bool update() {
+        if (!(middle.load(std::memory_order_relaxed) & FRESH)) return false;
+        std::uint8_t previous =
+            middle.exchange(front, std::memory_order_acq_rel);
+        front = previous & INDEX_MASK;
+        return true;
+    }
+    bool hasUpdate() const {
+        return middle.load(std::memory_order_acquire) & FRESH;
+    }
+    const T& readSlot() const { return slots[front]; }
+
+   private:
+    static constexpr std::uint8_t INDEX_MASK = 0x3;
+    static constexpr std::uint8_t FRESH = 0x4;
+
+    std::array<T, 3> slots{};
+    std::uint8_t front{0};
+    std::atomic<std::uint8_t> middle{1};
+    std::uint8_t back{2};
+};
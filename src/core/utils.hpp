@@ -1,43 +1,9 @@
 #pragma once
 
 #include <algorithm>
-#include <random>
-#include <stdexcept>
-
-class RandomEngine {
-   public:
-    static RandomEngine& instance() {
-        static RandomEngine inst;
-        return inst;
-    }
-
-    std::mt19937& getGenerator() { return gen; }
-
-    int getInt(int max) {
-        if (max <= 0) return 0;
-        std::uniform_int_distribution<int> distrib(0, max);
-        return distrib(gen);
-    }
-
-    int getInt(int min, int max) {
-        std::uniform_int_distribution<int> distrib(min, max);
-        return distrib(gen);
-    }
-    RandomEngine(const RandomEngine&) = delete;
-    RandomEngine& operator=(const RandomEngine&) = delete;
-
-   private:
-    RandomEngine() : gen(rd()) {}
-    std::random_device rd;
-    std::mt19937 gen;
-};
-
-inline int randomInt(int max) { return RandomEngine::instance().getInt(max); }
-template <typename Container>
-int randomIndex(const Container& container) {
-    if (container.empty()) throw std::runtime_error("Container is empty");
-    return randomInt(container.size() - 1);
-}
+#include <cctype>
+#include <string>
+#include <string_view>
 
 namespace strutils {
 
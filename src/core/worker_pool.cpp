@@ -0,0 +1,53 @@
+#include "worker_pool.hpp"
+
+#include <algorithm>
+
+WorkerPool::WorkerPool(int workers) {
+    for (int worker = 1; worker < std::max(workers, 1); ++worker)
+        threads.emplace_back([this, worker] { workerLoop(worker); });
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& thread : threads) thread.join();
+}
+
+void WorkerPool::run(const std::function<void(int)>& task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        currentTask = &task;
+        pending = static_cast<int>(threads.size());
+        ++generation;
+    }
+    wake.notify_all();
+    task(0);
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this] { return pending == 0; });
+    currentTask = nullptr;
+}
+
+void WorkerPool::workerLoop(int worker) {
+    std::uint64_t seenGeneration = 0;
+    while (true) {
+        const std::function<void(int)>* task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] {
+                return stopping || generation != seenGeneration;
+            });
+            if (stopping) return;
+            seenGeneration = generation;
+            task = currentTask;
+        }
+        (*task)(worker);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            --pending;
+        }
+        finished.notify_one();
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Threads fixas para trabalho do tipo fork-join: run(task) chama task(worker)
+// uma vez em cada worker, com a thread chamadora como worker 0, e só retorna
+// quando todos terminarem. Com um worker nenhuma thread é criada.
+class WorkerPool {
+   public:
+    explicit WorkerPool(int workers);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    int size() const { return static_cast<int>(threads.size()) + 1; }
+    void run(const std::function<void(int)>& task);
+
+   private:
+    void workerLoop(int worker);
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    const std::function<void(int)>* currentTask{};
+    std::uint64_t generation{};
+    int pending{};
+    bool stopping{};
+};
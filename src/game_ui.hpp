@@ -6,6 +6,19 @@
 #include "SFML/System/Time.hpp"
 #include "game_defs.hpp"
 
+inline std::string attackOutcomeToString(AttackOutcome outcome) {
+    switch (outcome) {
+        case AttackOutcome::Miss:
+            return "água";
+        case AttackOutcome::Hit:
+            return "acertou";
+        case AttackOutcome::Sunk:
+            return "afundou";
+        default:
+            return "repetida";
+    }
+}
+
 struct RenderData {
     const bool changedGrids;
     const sf::Time deltaTime;
@@ -14,15 +27,21 @@ struct RenderData {
 class GameUI {
    public:
     virtual ~GameUI() = default;
-    using onPlayerMoveFn = std::function<void(std::string)>;
+    using onPlayerMoveFn = std::function<void(const MoveParseResult&)>;
 
     virtual sf::Time getPreferredRenderInterval() = 0;
     virtual void onNewGame() = 0;
     virtual void onGameClosed() = 0;
     virtual bool isOpen() const = 0;
+    // Bloqueia até haver um evento de entrada ou o tempo acabar. Sem nada a
+    // redesenhar, a UI pode ignorar o prazo e esperar só pela entrada;
+    // changedGrids avisa que os grids mudaram desde o último render.
+    virtual void waitForEvents(sf::Time timeout, bool changedGrids) = 0;
     virtual void processInput(bool shouldReceivePlayerMove) = 0;
-    virtual void onBotMove(const Position& pos) = 0;
-    virtual void onPlayerMove(const Position& pos) = 0;
+    // A jogada do bot ainda está sendo calculada em segundo plano.
+    virtual void onBotThinking() = 0;
+    virtual void onBotMove(const Position& pos, AttackOutcome outcome) = 0;
+    virtual void onPlayerMove(const Position& pos, AttackOutcome outcome) = 0;
     virtual void onInvalidMoveMessage() = 0;
     virtual void onParseError(MoveParseError moveError) = 0;
     virtual void onGameOver(GameSide winner) = 0;
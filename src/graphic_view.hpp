@@ -1,15 +1,23 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <condition_variable>
 #include <filesystem>
+#include <map>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <tuple>
 
 #include "SFML/Window/Event.hpp"
+#include "board_mesh.hpp"
+#include "board_snapshot.hpp"
 #include "game_ui.hpp"
 #include "grid.hpp"
 #include "move_representation.hpp"
+#include "triple_buffer.hpp"
 
 static inline const std::filesystem::path FS_RESOURCES_PATH =
     std::filesystem::path(RESOURCES_PATH);
@@ -52,14 +60,53 @@ struct GameStatus {
     }
 };
 
-inline void drawText(sf::RenderWindow& window, const std::string& text,
-                     const TextDetails& details) {
-    sf::Text sfText(text, *details.font, details.style.size);
-    sfText.setFillColor(details.style.color);
-    sfText.setPosition(details.position);
-    window.draw(sfText);
-}
+// Tudo o que a thread de desenho precisa para um quadro.
+struct FrameSnapshot {
+    BoardSnapshot player;
+    BoardSnapshot bot;
+    GameStatus status;
+};
+
+// sf::Text já montados, por conteúdo e estilo. O sf::Text só refaz a
+// geometria quando texto, fonte ou tamanho mudam, então reaproveitá-lo evita
+// remontar as mesmas linhas a cada quadro.
+class TextCache {
+   public:
+    const sf::Text& get(const std::string& text, const TextDetails& details) {
+        Key key{text, details.font, details.style.size,
+                details.style.color.toInteger()};
+        auto it = texts.find(key);
+        if (it == texts.end()) {
+            if (texts.size() >= MAX_ENTRIES) texts.clear();
+            sf::Text sfText(text, *details.font, details.style.size);
+            sfText.setFillColor(details.style.color);
+            it = texts.emplace(std::move(key), std::move(sfText)).first;
+        }
+        it->second.setPosition(details.position);
+        return it->second;
+    }
+
+    // Rasteriza de antemão os glifos ASCII e Latin-1 no atlas da fonte, para
+    // o primeiro texto de cada tamanho não pagar por isso durante o jogo.
+    static void prewarm(const sf::Font& font, unsigned int size) {
+        for (sf::Uint32 c = 0x20; c <= 0xFF; ++c)
+            if (c < 0x7F || c >= 0xC0) font.getGlyph(c, size, false);
+    }
+
+   private:
+    using Key =
+        std::tuple<std::string, const sf::Font*, unsigned int, sf::Uint32>;
+
+    static constexpr size_t MAX_ENTRIES = 256;
+
+    std::map<Key, sf::Text> texts;
+};
 
+// Eventos e lógica ficam na thread principal, que só lê os grids para
+// publicar snapshots num TripleBuffer. Uma thread de desenho, dona do
+// contexto OpenGL da janela, desenha sempre o snapshot mais novo e espera o
+// vsync sozinha, então o ritmo do jogo e a taxa de quadros não dependem um do
+// outro.
 class GraphicUI : public GameUI {
    public:
     GraphicUI(onPlayerMoveFn onPlayerMoveCallback,
@@ -67,69 +114,106 @@ class GraphicUI : public GameUI {
         : window(sf::VideoMode(WINDOW_DIMENSION.width, WINDOW_DIMENSION.height),
                  "Batalha Naval"),
           playerView(playerGridView),
-          botView(botGridView) {
+          botView(botGridView),
+          playerMesh(playerGridView.dimension(), {GRID_LEFT_X, GRID_TOP_Y},
+                     CELL_SIZE, CELL_PADDING, PLAYER_PALETTE),
+          botMesh(botGridView.dimension(), {GRID_RIGHT_X, GRID_TOP_Y},
+                  CELL_SIZE, CELL_PADDING, BOT_PALETTE) {
         this->onPlayerMoveCallback = onPlayerMoveCallback;
         window.setVerticalSyncEnabled(true);
         auto fontPath = FS_RESOURCES_PATH / "arial-regular.ttf";
         if (!font.loadFromFile(fontPath.string()))
             throw std::runtime_error("Não foi possível carregar a fonte: " +
                                      fontPath.string());
+        for (const TextStyle& style : {STATUS_STYLE, GAME_OVER_STYLE})
+            TextCache::prewarm(font, style.size);
+
+        refreshFrame();
+        publishFrame();
+        window.setActive(false);
+        renderThread = std::thread(&GraphicUI::renderLoop, this);
     }
 
-    ~GraphicUI() override = default;
+    ~GraphicUI() override { stopRenderThread(); }
 
     sf::Time getPreferredRenderInterval() override {
         return sf::seconds(1.0f / this->GAME_FPS);
     }
 
-    void onNewGame() override { gameStatus.reset(); }
+    void onNewGame() override {
+        gameStatus.reset();
+        dirty = true;
+    }
 
     void onGameClosed() override {
         gameStatus.frozen = true;
-        gameStatus.statusText = "Jogo encerrado. Tela congelada.";
+        setStatusText("Jogo encerrado. Tela congelada.");
     }
 
     bool isOpen() const override { return window.isOpen(); }
 
+    // Sem nada a publicar, bloqueia em waitEvent até a próxima entrada.
+    // Senão, como o SFML não tem espera com prazo, a fila é consultada em
+    // fatias curtas de sono. O evento encontrado fica guardado para
+    // processInput.
+    void waitForEvents(sf::Time timeout, bool changedGrids) override {
+        if (pendingEvent) return;
+        sf::Event event;
+        if (!dirty && !changedGrids) {
+            if (window.waitEvent(event)) pendingEvent = event;
+            return;
+        }
+        sf::Clock clock;
+        while (!window.pollEvent(event)) {
+            sf::Time remaining = timeout - clock.getElapsedTime();
+            if (remaining <= sf::Time::Zero) return;
+            sf::sleep(std::min(remaining, EVENT_POLL_INTERVAL));
+        }
+        pendingEvent = event;
+    }
+
     void processInput(bool shouldReceivePlayerMove) override {
         sf::Event event;
-        while (window.pollEvent(event)) {
+        while (nextEvent(event)) {
             if (event.type == sf::Event::Closed) {
+                stopRenderThread();
                 window.close();
                 return;
             }
+            if (exposesWindow(event)) dirty = true;
             if (gameStatus.frozen) continue;
             auto botCellPosition = getBotCellPosition(event);
-            if (shouldReceivePlayerMove && botCellPosition) {
-                std::string moveStr =
-                    MoveRepresentation::moveToStrCoordinate(*botCellPosition);
-                onPlayerMoveCallback(moveStr);
-            }
+            if (shouldReceivePlayerMove && botCellPosition)
+                onPlayerMoveCallback(
+                    {*botCellPosition, MoveParseError::None});
         }
     }
 
-    void onBotMove(const Position& pos) override {
-        gameStatus.statusText =
-            "Bot atacou: " + MoveRepresentation::moveToStrCoordinate(pos);
+    void onBotThinking() override { setStatusText("Bot pensando..."); }
+
+    void onBotMove(const Position& pos, AttackOutcome outcome) override {
+        setStatusText("Bot atacou: " +
+                      MoveRepresentation::moveToStrCoordinate(pos) + " (" +
+                      attackOutcomeToString(outcome) + ")");
     }
 
-    void onPlayerMove(const Position& pos) override {
-        gameStatus.statusText =
-            "Você atacou: " + MoveRepresentation::moveToStrCoordinate(pos);
+    void onPlayerMove(const Position& pos, AttackOutcome outcome) override {
+        setStatusText("Você atacou: " +
+                      MoveRepresentation::moveToStrCoordinate(pos) + " (" +
+                      attackOutcomeToString(outcome) + ")");
     }
 
     void onInvalidMoveMessage() override {
-        gameStatus.statusText = u8"Jogada inválida.";
+        setStatusText(u8"Jogada inválida.");
     }
 
     void onParseError(MoveParseError moveError) override {
         if (moveError == MoveParseError::InvalidFormat)
-            gameStatus.statusText =
-                "Formato inválido. Use letra+numero (ex: A5).";
+            setStatusText("Formato inválido. Use letra+numero (ex: A5).");
         else if (moveError == MoveParseError::OutOfBounds)
-            gameStatus.statusText = "Movimento fora dos limites do tabuleiro.";
+            setStatusText("Movimento fora dos limites do tabuleiro.");
         else
-            gameStatus.statusText = "Erro ao interpretar movimento.";
+            setStatusText("Erro ao interpretar movimento.");
     }
 
     void onGameOver(GameSide winnerSide) override {
@@ -137,23 +221,95 @@ class GraphicUI : public GameUI {
         gameStatus.winner = winnerSide;
         gameStatus.statusText =
             "Fim de jogo! Vencedor: " + gameSideToString(gameStatus.winner);
+        dirty = true;
     }
 
-    void render(const RenderData&) override {
-        window.clear(BG_COLOR);
+    // Só publica o snapshot; desenhar é com a thread de desenho. Sem mudança
+    // nada é publicado, e a janela continua com o último quadro completo.
+    // Os tabuleiros só são copiados de novo quando a lógica avisa que mudaram
+    // ou quando o quadro vai ser publicado de qualquer forma (status novo,
+    // janela exposta, fim de jogo), para nunca republicar grids velhos.
+    void render(const RenderData& renderData) override {
+        if (renderData.changedGrids || dirty) refreshFrame();
+        if (!dirty) return;
+        dirty = false;
+        publishFrame();
+    }
 
-        drawTitles();
+   private:
+    void setStatusText(const std::string& text) {
+        if (gameStatus.statusText == text) return;
+        gameStatus.statusText = text;
+        dirty = true;
+    }
 
+    void refreshFrame() {
+        BoardSnapshot player = BoardSnapshot::of(playerView);
+        BoardSnapshot bot = BoardSnapshot::of(botView);
+        if (player == frame.player && bot == frame.bot) return;
+        frame.player = player;
+        frame.bot = bot;
+        dirty = true;
+    }
+
+    void publishFrame() {
+        FrameSnapshot& next = frames.writeSlot();
+        next = frame;
+        next.status = gameStatus;
+        frames.publish();
+        { std::lock_guard<std::mutex> lock(renderMutex); }
+        renderWake.notify_one();
+    }
+
+    // A janela precisa ser fechada na thread principal, depois que a de
+    // desenho soltou o contexto.
+    void stopRenderThread() {
+        if (!renderThread.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(renderMutex);
+            stopping = true;
+        }
+        renderWake.notify_one();
+        renderThread.join();
+    }
+
+    // O primeiro snapshot é publicado no construtor, então já há um quadro
+    // para desenhar quando a thread começa.
+    void renderLoop() {
+        window.setActive(true);
+        frames.update();
+        buildStaticLayer();
+        drawFrame(frames.readSlot());
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(renderMutex);
+                renderWake.wait(
+                    lock, [&] { return stopping || frames.hasUpdate(); });
+                if (stopping) break;
+            }
+            frames.update();
+            drawFrame(frames.readSlot());
+        }
+        window.setActive(false);
+    }
+
+    void drawFrame(const FrameSnapshot& snapshot) {
+        playerMesh.update(snapshot.player);
+        botMesh.update(snapshot.bot);
+
+        window.clear(BG_COLOR);
+        window.draw(staticSprite);
+        window.draw(playerMesh);
+        window.draw(botMesh);
+
+        const GameStatus& status = snapshot.status;
         TextDetails statusDetails{
             STATUS_STYLE,
             &font,
             {WINDOW_DIMENSION.width * 0.5f - STATUS_WIDTH * 0.5f, 8.0f}};
-        drawText(window, gameStatus.statusText, statusDetails);
-
-        drawGrid(playerView, GRID_LEFT_X, GRID_TOP_Y, true);
-        drawGrid(botView, GRID_RIGHT_X, GRID_TOP_Y, false);
+        drawText(window, status.statusText, statusDetails);
 
-        if (gameStatus.isGameOver) {
+        if (status.isGameOver) {
             TextDetails gameOverDetails{
                 GAME_OVER_STYLE,
                 &font,
@@ -161,94 +317,96 @@ class GraphicUI : public GameUI {
             drawText(window, "Fim de jogo!", gameOverDetails);
 
             gameOverDetails.position.y = 64.0f;
-            drawText(window, "Vencedor: " + gameSideToString(gameStatus.winner),
+            drawText(window, "Vencedor: " + gameSideToString(status.winner),
                      gameOverDetails);
         }
 
         window.display();
     }
 
-   private:
+    // O SFML não tem evento de exposição; redimensionar ou voltar ao foco
+    // pode ter invalidado o conteúdo da janela.
+    static bool exposesWindow(const sf::Event& event) {
+        return event.type == sf::Event::Resized ||
+               event.type == sf::Event::GainedFocus ||
+               event.type == sf::Event::MouseEntered;
+    }
+
+    bool nextEvent(sf::Event& event) {
+        if (!pendingEvent) return window.pollEvent(event);
+        event = *pendingEvent;
+        pendingEvent.reset();
+        return true;
+    }
+
+    void drawText(sf::RenderTarget& target, const std::string& text,
+                  const TextDetails& details) {
+        target.draw(textCache.get(text, details));
+    }
+
     std::optional<Position> getBotCellPosition(const sf::Event& event) const {
         if (!EventUtils::isLeftMousePress(event)) return std::nullopt;
         auto mouse = sf::Mouse::getPosition(window);
         return mapMouseToBotCell(mouse);
     }
 
+    // Títulos, rótulos e linhas da grade não mudam durante o jogo: são
+    // desenhados uma vez numa textura e copiados com um único draw por quadro.
+    void buildStaticLayer() {
+        if (!staticLayer.create(WINDOW_DIMENSION.width,
+                                WINDOW_DIMENSION.height))
+            throw std::runtime_error(
+                "Não foi possível criar a textura do tabuleiro");
+        staticLayer.clear(BG_COLOR);
+        drawTitles();
+        drawGridFrame(frames.readSlot().player.dimension(), GRID_LEFT_X,
+                      GRID_TOP_Y);
+        drawGridFrame(frames.readSlot().bot.dimension(), GRID_RIGHT_X,
+                      GRID_TOP_Y);
+        staticLayer.display();
+        staticSprite.setTexture(staticLayer.getTexture(), true);
+    }
+
     void drawTitles() {
         TextDetails leftTitle{
             TITLE_STYLE, &font, {GRID_LEFT_X, GRID_TOP_Y - 40}};
-        drawText(window, "GRID DO JOGADOR", leftTitle);
+        drawText(staticLayer, "GRID DO JOGADOR", leftTitle);
 
         TextDetails rightTitle{
             TITLE_STYLE, &font, {GRID_RIGHT_X, GRID_TOP_Y - 40}};
-        drawText(window, "GRID DO BOT", rightTitle);
+        drawText(staticLayer, "GRID DO BOT", rightTitle);
     }
 
-    void drawGrid(const GridView& gridView, float originX, float originY,
-                  bool showShips) {
-        Dimension dim = gridView.dimension();
+    // O contorno de 1 px das células forma um fundo contínuo sob o tabuleiro,
+    // então basta um retângulo; as células do BoardMesh ficam por cima.
+    void drawGridFrame(Dimension dim, float originX, float originY) {
         const int w = static_cast<int>(dim.width);
         const int h = static_cast<int>(dim.height);
 
-        sf::RectangleShape cellShape(
-            sf::Vector2f(CELL_SIZE - CELL_PADDING, CELL_SIZE - CELL_PADDING));
-
+        sf::RectangleShape frame(sf::Vector2f(w * CELL_SIZE, h * CELL_SIZE));
+        frame.setFillColor(GRID_LINE_COLOR);
+        frame.setPosition(originX - 1.0f, originY - 1.0f);
+        staticLayer.draw(frame);
+
+        for (int x = 0; x < w; ++x) {
+            TextDetails colLabel{TITLE_STYLE,
+                                 &font,
+                                 {originX + x * CELL_SIZE + 6, originY - 18}};
+            drawText(staticLayer, std::string(1, static_cast<char>('A' + x)),
+                     colLabel);
+        }
         for (int y = 0; y < h; ++y) {
-            for (int x = 0; x < w; ++x) {
-                CellType cell = gridView.get(x, y);
-                std::string cellSymbol = cellTypeToSymbol(cell);
-
-                sf::Color fill = WATER_COLOR;
-                if (cell == CellType::Ship) {
-                    fill = showShips ? SHIP_COLOR : WATER_COLOR;
-                } else if (cell == CellType::AttackedShip) {
-                    fill = ATTACKED_SHIP_COLOR;
-                } else if (cell == CellType::AttackedWater) {
-                    fill = ATTACKED_WATER_COLOR;
-                }
-
-                cellShape.setFillColor(fill);
-                cellShape.setOutlineThickness(1.0f);
-                cellShape.setOutlineColor(GRID_LINE_COLOR);
-                cellShape.setPosition(originX + x * CELL_SIZE,
-                                      originY + y * CELL_SIZE);
-                window.draw(cellShape);
-
-                // Desenhar labels das colunas (A, B, C...)
-                if (y == 0) {
-                    TextDetails colLabel{
-                        TITLE_STYLE,
-                        &font,
-                        {originX + x * CELL_SIZE + 6, originY - 18}};
-                    drawText(window, std::string(1, static_cast<char>('A' + x)),
-                             colLabel);
-                }
-                // Desenhar labels das linhas (1, 2, 3...)
-                if (x == 0) {
-                    TextDetails rowLabel{
-                        TITLE_STYLE,
-                        &font,
-                        {originX - 22, originY + y * CELL_SIZE + 4}};
-                    drawText(window, std::to_string(y + 1), rowLabel);
-                }
-            }
+            TextDetails rowLabel{TITLE_STYLE,
+                                 &font,
+                                 {originX - 22, originY + y * CELL_SIZE + 4}};
+            drawText(staticLayer, std::to_string(y + 1), rowLabel);
         }
     }
 
-    std::string cellTypeToSymbol(CellType type) {
-        static const std::map<CellType, std::string> typeToSymbol{
-            {CellType::Water, " "},
-            {CellType::Ship, "█"},
-            {CellType::AttackedShip, "X"},
-            {CellType::AttackedWater, "^"}};
-
-        return typeToSymbol.count(type) ? typeToSymbol.at(type) : "?";
-    }
-
     std::optional<Position> mapMouseToBotCell(const sf::Vector2i& mouse) const {
-        const int gridW = 10;
-        const int gridH = 10;
+        Dimension dim = botView.dimension();
+        const int gridW = static_cast<int>(dim.width);
+        const int gridH = static_cast<int>(dim.height);
 
         int relX = mouse.x - static_cast<int>(GRID_RIGHT_X);
         int relY = mouse.y - static_cast<int>(GRID_TOP_Y);
@@ -276,11 +434,30 @@ class GraphicUI : public GameUI {
     const GridView& playerView;
     const GridView& botView;
 
+    // Thread principal.
     sf::RenderWindow window;
-    sf::Font font;
     GameStatus gameStatus;
+    std::optional<sf::Event> pendingEvent;
+    bool dirty{true};
+    FrameSnapshot frame;
+
+    // Entre as threads.
+    TripleBuffer<FrameSnapshot> frames;
+    std::mutex renderMutex;
+    std::condition_variable renderWake;
+    bool stopping{};
+    std::thread renderThread;
+
+    // Thread de desenho; a fonte é carregada antes de ela começar.
+    sf::Font font;
+    TextCache textCache;
+    sf::RenderTexture staticLayer;
+    sf::Sprite staticSprite;
+    BoardMesh playerMesh;
+    BoardMesh botMesh;
 
     static constexpr unsigned int GAME_FPS = 60;
+    static inline const sf::Time EVENT_POLL_INTERVAL = sf::milliseconds(2);
     static constexpr Dimension WINDOW_DIMENSION = {900, 600};
     static constexpr float CELL_SIZE = 32.0f;
     static constexpr float CELL_PADDING = 2.0f;
@@ -295,6 +472,11 @@ class GraphicUI : public GameUI {
     static inline const sf::Color ATTACKED_SHIP_COLOR = sf::Color(220, 20, 60);
     static inline const sf::Color ATTACKED_WATER_COLOR =
         sf::Color(200, 200, 200);
+    // Na ordem de CellType: Ship, Water, AttackedShip, AttackedWater.
+    static inline const CellPalette PLAYER_PALETTE = {
+        SHIP_COLOR, WATER_COLOR, ATTACKED_SHIP_COLOR, ATTACKED_WATER_COLOR};
+    static inline const CellPalette BOT_PALETTE = {
+        WATER_COLOR, WATER_COLOR, ATTACKED_SHIP_COLOR, ATTACKED_WATER_COLOR};
 
     static inline const TextStyle TITLE_STYLE = {16, sf::Color::White};
     static inline const TextStyle STATUS_STYLE = {16, sf::Color::White};
@@ -1,339 +1,22 @@
-#include <cctype>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
 #include <memory>
 #include <optional>
 #include <string>
-#include <utility>
-#include <vector>
 
-#include "cell.hpp"
+#include "command_line.hpp"
+#include "game.hpp"
 #include "game_defs.hpp"
+#include "game_logic.hpp"
+#include "game_setup.hpp"
 #include "geometry.hpp"
 #include "graphic_view.hpp"
-#include "grid.hpp"
-#include "move_representation.hpp"
-#include "ship.hpp"
 #include "terminal_view.hpp"
-#include "utils.hpp"
 
-constexpr int GRID_WIDTH = 10;
-constexpr int GRID_HEIGHT = 10;
-constexpr int SHIPS_AMOUNT = 6;
-
-struct Game {
-    Grid botGrid;
-    Grid playerGrid;
-    std::vector<Ship> botShips;
-    std::vector<Ship> playerShips;
-    GridView playerGridView;
-    GridView botGridView;
-    int targetTotalShipSize;
-    int shipsAmount;
-
-    Game(int gridWidth, int gridHeight, int shipsAmount)
-        : botGrid(gridWidth, gridHeight),
-          playerGrid(gridWidth, gridHeight),
-          shipsAmount(shipsAmount),
-          playerGridView(playerGrid),
-          botGridView(botGrid) {}
-};
-
-class GameSetup {
-   public:
-    void setupGame(Game& game) const {
-        ShipManager shipManager;
-        game.botShips = selectRandomShips(shipManager, game.shipsAmount);
-        game.playerShips = selectRandomShips(shipManager, game.shipsAmount);
-        game.targetTotalShipSize = calculateTotalShipsSize(game.botShips);
-        equalizeTotalSize(game.playerShips, game.targetTotalShipSize,
-                          shipManager);
-        for (auto& sh : game.botShips) placeRandomly(game.botGrid, sh);
-        for (auto& sh : game.playerShips) placeRandomly(game.playerGrid, sh);
-    }
-
-   private:
-    void placeRandomly(Grid& grid, const Ship& ship) const {
-        auto [pos, direction] = getRandomPlacement(grid, ship.size);
-        grid.placeShip(ship, pos, direction);
-    }
-
-    std::pair<Position, Direction> getRandomPlacement(const Grid& grid,
-                                                      int size) const {
-        std::vector<Direction> filteredDirections;
-        Position position;
-        do {
-            position = grid.getRandomPosition();
-            auto directions = grid.validDirections(position, size);
-            filteredDirections = filterDirections(directions);
-        } while (filteredDirections.empty());
-        size_t randomDirectionIndex = randomIndex(filteredDirections);
-        return {position, filteredDirections[randomDirectionIndex]};
-    }
-
-    std::vector<Direction> filterDirections(
-        const std::vector<Direction>& dirs) const {
-        std::vector<Direction> filtered;
-        for (const auto& direction : dirs)
-            if (direction == Direction::Right || direction == Direction::Down)
-                filtered.push_back(direction);
-        return filtered;
-    }
-
-    std::vector<Ship> selectRandomShips(const ShipManager& manager,
-                                        int amount) const {
-        std::vector<Ship> ships;
-        ships.reserve(amount);
-        for (int i = 0; i < amount; ++i)
-            ships.push_back(manager.getRandomShip());
-        return ships;
-    }
-
-    void equalizeTotalSize(std::vector<Ship>& playerShips,
-                           const int botTotalSize,
-                           const ShipManager& shipManager) const {
-        int totalDiff = botTotalSize - calculateTotalShipsSize(playerShips);
-        while (totalDiff != 0) {
-            Ship candidate = shipManager.getRandomShip();
-            Ship* currentPtr = &playerShips[randomIndex(playerShips)];
-            const auto& [bestShip, diffChange] =
-                chooseBestShip(totalDiff, *currentPtr, candidate);
-            totalDiff -= diffChange;
-            *currentPtr = bestShip;
-        }
-    }
-
-    std::pair<const Ship&, int> chooseBestShip(int& totalDifference,
-                                               const Ship& current,
-                                               const Ship& candidate) const {
-        int diffChange = candidate.size - current.size;
-        if (std::abs(totalDifference - diffChange) < std::abs(totalDifference))
-            return {candidate, diffChange};
-        return {current, 0};
-    }
-
-    int calculateTotalShipsSize(const std::vector<Ship>& ships) const {
-        int total = 0;
-        for (const auto& ship : ships) total += ship.size;
-        return total;
-    }
-};
-
-class BotAI {
-   public:
-    Position computeBotMove(Grid& grid) {
-        switch (state) {
-            case BotState::Searching:
-                return computeSearchingMove(grid);
-            case BotState::Targeting:
-                return computeTargetingMove(grid);
-            case BotState::Finishing:
-                return computeFinishingMove(grid);
-        }
-        return {};
-    }
-
-    void onLastHitSunkShip() { state = BotState::Searching; }
-
-   private:
-    Position computeSearchingMove(Grid& grid) {
-        Position pos = pickRandomAvailableCell(grid);
-        if (grid.isType(pos, CellType::Ship)) {
-            state = BotState::Targeting;
-            initialHitPos = pos;
-            remainingDirections = {Direction::Up, Direction::Down,
-                                   Direction::Left, Direction::Right};
-        }
-        return pos;
-    }
-
-    Position pickRandomAvailableCell(Grid& grid) const {
-        Position pos{};
-        do {
-            pos = grid.getRandomPosition();
-        } while (!isAttackableCell(grid, pos));
-        return pos;
-    }
-
-    Position computeTargetingMove(Grid& grid) {
-        remainingDirections = filterAttackableDirections(grid, initialHitPos,
-                                                         remainingDirections);
-        if (remainingDirections.empty()) {
-            state = BotState::Searching;
-            return computeSearchingMove(grid);
-        }
-        shipDirection = targetDirectionFromRemaining();
-        lastPos = incrementToDirection(initialHitPos, shipDirection);
-        if (grid.isType(lastPos, CellType::Ship)) state = BotState::Finishing;
-        return lastPos;
-    }
-
-    std::vector<Direction> filterAttackableDirections(
-        Grid& grid, const Position& pos,
-        const std::vector<Direction>& directions) const {
-        std::vector<Direction> filtered;
-        for (auto& direction : directions)
-            if (isAttackableCell(grid, incrementToDirection(pos, direction)))
-                filtered.push_back(direction);
-        return filtered;
-    }
-
-    Direction targetDirectionFromRemaining() {
-        std::shuffle(remainingDirections.begin(), remainingDirections.end(),
-                     RandomEngine::instance().getGenerator());
-        Direction direction = remainingDirections.back();
-        remainingDirections.pop_back();
-        return direction;
-    }
-
-    Position incrementToDirection(const Position& pos,
-                                  const Direction& direction) const {
-        Position newPos = pos;
-        newPos.applyOffset(direction, 1);
-        return newPos;
-    }
-
-    bool isAttackableCell(Grid& grid, const Position& pos) const {
-        if (!grid.hasCell(pos)) return false;
-        const Cell& cell = grid.getCell(pos);
-        return attackedVersion(cell.type) != cell.type;
-    }
-
-    Position computeFinishingMove(Grid& grid) {
-        lastPos = incrementToDirection(lastPos, shipDirection);
-        if (isAfterEdge(grid)) invertDirectionAfterEdge(grid);
-        return lastPos;
-    }
-
-    bool isAfterEdge(Grid& grid) const {
-        return !grid.hasCell(lastPos) || !grid.isType(lastPos, CellType::Ship);
-    }
-
-    void invertDirectionAfterEdge(Grid& grid) {
-        lastPos = initialHitPos;
-        shipDirection = invertDirection(shipDirection);
-        lastPos.applyOffset(shipDirection, 1);
-    }
-
-   private:
-    enum class BotState { Searching, Targeting, Finishing };
-    BotState state = BotState::Searching;
-    Position initialHitPos;
-    Position lastPos;
-    Direction shipDirection;
-    std::vector<Direction> remainingDirections;
-};
-
-struct CellAttackResult {
-    CellType cellType;
-    bool changedCell;
-};
-
-class GameLogic {
-   public:
-    GameLogic(std::unique_ptr<Game> game) : game(std::move(game)) {
-        botAI = {};
-    }
-
-    void setup(const GameSetup& setup) {
-        setup.setupGame(*game);
-        turn = GameSide::Player;
-    }
-
-    const GridView& playerView() const { return game->playerGridView; }
-    const GridView& botView() const { return game->botGridView; }
-
-    bool isGameOver() {
-        return totalBotShipHit == game->targetTotalShipSize ||
-               totalPlayerShipHit == game->targetTotalShipSize;
-    }
-
-    GameSide winner() {
-        if (totalPlayerShipHit == game->targetTotalShipSize)
-            return GameSide::Player;
-        if (totalBotShipHit == game->targetTotalShipSize) return GameSide::Bot;
-        return GameSide::None;
-    }
-
-    GameSide currentTurn() const { return turn; }
-
-    Position botMove() {
-        Position pos = botAI.computeBotMove(game->playerGrid);
-        processMove(game->playerGrid, pos);
-        lastBotMoves.push_back(pos);
-        return pos;
-    }
-
-    std::vector<Position> popAllBotMoves() {
-        return std::exchange(lastBotMoves, {});
-    }
-
-    bool playerMove(const Position& move) {
-        CellAttackResult result = processMove(game->botGrid, move);
-        return result.changedCell;
-    }
-
-    bool hitBotShipSuccess(const Position& move) {
-        return game->botGrid.isType(move, CellType::AttackedShip);
-    }
-
-    MoveParseResult parsePlayerMove(const std::string& input) const {
-        return MoveRepresentation::parseMove(input,
-                                             game->playerGrid.dimension());
-    }
-
-    std::string moveToStrCoordinate(const Position& move) const {
-        return MoveRepresentation::moveToStrCoordinate(move);
-    }
-
-   private:
-    void switchTurn() {
-        turn = (turn == GameSide::Player) ? GameSide::Bot : GameSide::Player;
-    }
-
-    CellAttackResult processMove(Grid& grid, const Position& move) {
-        Cell& cell = grid.getCell(move);
-        CellType attackedCellVersion = attackedVersion(cell.type);
-        bool changedCell = attackedCellVersion != cell.type;
-        if (changedCell) {
-            cell.type = attackedCellVersion;
-            processHit(grid, move);
-        }
-        return {cell.type, changedCell};
-    }
-
-    void processHit(Grid& grid, const Position& move) {
-        if (grid.isType(move, CellType::AttackedShip)) {
-            if (turn == GameSide::Player)
-                ++totalPlayerShipHit;
-            else
-                ++totalBotShipHit;
-        }
-        bool isSunk = isShipSunk(grid, move);
-        if (turn == GameSide::Bot && isSunk) botAI.onLastHitSunkShip();
-        bool hitShipNotSunking =
-            grid.isType(move, CellType::AttackedShip) && !isSunk;
-        if (!hitShipNotSunking) switchTurn();
-    }
-
-    static bool isShipSunk(Grid& grid, const Position& pos) {
-        if (!grid.hasCell(pos) || !grid.isType(pos, CellType::AttackedShip))
-            return false;
-        ShipBody& shipBody = grid.getCell(pos).shipBody;
-        Position currentPos = shipBody.initialPos;
-        for (int offset = 0; offset < shipBody.ship->size; ++offset) {
-            if (grid.isType(currentPos, CellType::Ship)) return false;
-            currentPos.applyOffset(shipBody.direction, 1);
-        }
-        return true;
-    }
-
-   private:
-    std::unique_ptr<Game> game;
-    std::vector<Position> lastBotMoves;
-    BotAI botAI;
-    int totalBotShipHit{};
-    int totalPlayerShipHit{};
-    GameSide turn;
-};
+constexpr int GRID_WIDTH = STANDARD_BOARD_WIDTH;
+constexpr int GRID_HEIGHT = STANDARD_BOARD_HEIGHT;
+constexpr int SHIPS_AMOUNT = STANDARD_SHIPS_AMOUNT;
 
 class GameLoop {
    public:
@@ -344,14 +27,19 @@ class GameLoop {
         renderInterval = gameUI.getPreferredRenderInterval();
     }
 
-    void onPlayerMove(std::string moveInput) {
-        this->moveInput = moveInput;
+    // Partida bot contra bot: autoPlayer joga no lugar do jogador, sem
+    // esperar entrada, e os quadros seguem no ritmo da UI.
+    void setAutoPlayer(BotAI& autoPlayer) { this->autoPlayer = &autoPlayer; }
+
+    void onPlayerMove(const MoveParseResult& move) {
+        this->playerMove = move;
         waitingMove = false;
     }
 
     void run() {
         gameUI->onNewGame();
         readyForNewPlayerTurn = true;
+        changedGrids = true;
         renderClock.restart();
 
         while (gameUI->isOpen() && !gameLogic.isGameOver()) processTurn();
@@ -360,95 +48,158 @@ class GameLoop {
         gameUI->onGameClosed();
 
         while (gameUI->isOpen()) {
+            gameUI->waitForEvents(timeUntilRender(), changedGrids);
             gameUI->processInput(false);
-            renderIfDue(false);
+            renderIfDue();
         }
     }
 
    private:
     void processTurn() {
+        if (isIdle())
+            gameUI->waitForEvents(timeUntilRender(), changedGrids);
+        else if (botThinking)
+            updateBotThinking();
         gameUI->processInput(waitingMove);
         if (gameLogic.currentTurn() == GameSide::Player)
             handlePlayerTurn();
         else
             handleBotTurn();
-        renderIfDue(changedGrids);
-        changedGrids = false;
+        renderIfDue();
     }
 
-    void renderIfDue(bool changedGrids) {
+    // Só a entrada do jogador ou o próximo quadro podem mudar algo.
+    bool isIdle() const {
+        return gameLogic.currentTurn() == GameSide::Player && waitingMove;
+    }
+
+    // Enquanto o bot pensa, o loop espera pela jogada só até o próximo
+    // quadro, e a entrada e os quadros seguem no ritmo normal. O mínimo
+    // evita girar em vazio na UI de console, que não tem intervalo.
+    void updateBotThinking() {
+        auto timeout = std::chrono::microseconds(
+            std::max(timeUntilRender(), BOT_POLL_INTERVAL).asMicroseconds());
+        if (gameLogic.waitForBotMove(timeout)) return;
+        if (!announcedThinking) gameUI->onBotThinking();
+        announcedThinking = true;
+    }
+
+    sf::Time timeUntilRender() const {
+        return renderInterval - renderClock.getElapsedTime();
+    }
+
+    // changedGrids só é consumido quando o quadro é de fato entregue à UI.
+    void renderIfDue() {
         auto elapsed = renderClock.getElapsedTime();
         if (elapsed < renderInterval) return;
         gameUI->render({changedGrids, elapsed});
+        changedGrids = false;
         renderClock.restart();
     }
 
     void handlePlayerTurn() {
         if (readyForNewPlayerTurn) handleNewPlayerTurn();
         if (waitingMove) return;
-        auto move = processPlayerMove();
+        auto move = autoPlayer
+                        ? std::optional(gameLogic.playerBotMove(*autoPlayer))
+                        : processPlayerMove();
         if (processPlayerMoveResult(move)) readyForNewPlayerTurn = true;
     }
 
     void handleNewPlayerTurn() {
-        changedGrids = true;
-        for (auto botMove : gameLogic.popAllBotMoves())
-            gameUI->onBotMove(botMove);
-        waitingMove = true;
+        gameLogic.ponderBotMove();
+        waitingMove = !autoPlayer;
         readyForNewPlayerTurn = false;
     }
 
-    bool processPlayerMoveResult(const std::optional<Position>& move) {
+    bool processPlayerMoveResult(const std::optional<MoveRecord>& move) {
         if (!move) {
             waitingMove = true;
             return false;
         }
         waitingMove = false;
-        gameUI->onPlayerMove(*move);
+        changedGrids = true;
+        gameUI->onPlayerMove(move->pos, move->result.outcome);
         return true;
     }
 
-    std::optional<Position> processPlayerMove() const {
-        auto [pos, error] = gameLogic.parsePlayerMove(moveInput);
-        if (error == MoveParseError::None && gameLogic.playerMove(pos)) {
-            return pos;
-        }
-        if (error != MoveParseError::None)
+    std::optional<MoveRecord> processPlayerMove() const {
+        auto [pos, error] = playerMove;
+        if (error != MoveParseError::None) {
             gameUI->onParseError(error);
-        else
+            return std::nullopt;
+        }
+        AttackResult result = gameLogic.playerMove(pos);
+        if (!result.changedCell()) {
             gameUI->onInvalidMoveMessage();
-        return std::nullopt;
+            return std::nullopt;
+        }
+        return MoveRecord{pos, result};
     }
 
-    void handleBotTurn() { gameLogic.botMove(); }
+    // A jogada é calculada em segundo plano; se a reflexão feita durante o
+    // turno do jogador ainda vale, ela já está pronta. Cada jogada aplicada
+    // é anunciada e marca os grids para o próximo quadro.
+    void handleBotTurn() {
+        if (!botThinking) {
+            gameLogic.ponderBotMove();
+            botThinking = true;
+            announcedThinking = false;
+        }
+        if (!gameLogic.waitForBotMove(std::chrono::microseconds::zero()))
+            return;
+        botThinking = false;
+        gameLogic.botMove();
+        changedGrids = true;
+        for (const auto& botMove : gameLogic.popAllBotMoves())
+            gameUI->onBotMove(botMove.pos, botMove.result.outcome);
+    }
 
    private:
     GameLogic& gameLogic;
     GameUI* gameUI{};
+    BotAI* autoPlayer{};
     bool waitingMove{};
     bool readyForNewPlayerTurn{};
     bool changedGrids{};
-    std::string moveInput{};
+    bool botThinking{};
+    bool announcedThinking{};
+    MoveParseResult playerMove{};
 
     sf::Clock renderClock;
     sf::Time renderInterval;
+
+    static inline const sf::Time BOT_POLL_INTERVAL = sf::milliseconds(1);
 };
 
-bool hasArgument(int argc, char* argv[], std::string_view argument) {
-    for (int i = 1; i < argc; ++i) {
-        if (std::string(argv[i]) != argument) continue;
-        return true;
+int main(int argc, char* argv[]) {
+    if (hasArgument(argc, argv, "--simulate")) return runSimulation(argc, argv);
+
+    auto botSearch = searchArgument(argc, argv, "--bot-search");
+    auto playerSearch = searchArgument(argc, argv, "--player-search");
+    auto seed = seedArgument(argc, argv);
+    if (!botSearch || !playerSearch || !seed) {
+        std::cerr << "Uso: [--console] "
+                     "[--bot-search random|density|montecarlo|exact] "
+                     "[--autoplay "
+                     "[--player-search random|density|montecarlo|exact]] "
+                     "[--seed S]\n";
+        return 1;
     }
-    return false;
-}
 
-int main(int argc, char* argv[]) {
+    Random random(*seed);
     auto game = std::make_unique<Game>(GRID_WIDTH, GRID_HEIGHT, SHIPS_AMOUNT);
-    GameLogic logic(std::move(game));
-    GameSetup setup;
+    GameLogic logic(std::move(game), random, makeSearchStrategy(*botSearch));
+    GameSetup setup(random);
     logic.setup(setup);
     GameLoop gameLoop(logic);
 
+    // Fluxo próprio: o bot adversário pondera em outra thread com random.
+    Random autoPlayerRandom(random());
+    BotAI autoPlayer(autoPlayerRandom, makeSearchStrategy(*playerSearch));
+    if (hasArgument(argc, argv, "--autoplay"))
+        gameLoop.setAutoPlayer(autoPlayer);
+
     std::unique_ptr<GameUI> gameUI;
     if (hasArgument(argc, argv, "--console"))
         gameUI = std::make_unique<ConsoleUI>(
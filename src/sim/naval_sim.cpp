@@ -0,0 +1,7 @@
+// Torneios de bots sem interface: só depende do navalcore, então compila
+// também com NAVALCORE_ONLY. Aceita os mesmos argumentos do modo --simulate
+// do jogo.
+
+#include "command_line.hpp"
+
+int main(int argc, char* argv[]) { return runSimulation(argc, argv); }
@@ -6,6 +6,7 @@
 #include "game_ui.hpp"
 #include "grid.hpp"
 #include "move_representation.hpp"
+#include "utils.hpp"
 
 class ConsoleGridView {
    public:
@@ -97,23 +98,32 @@ class ConsoleUI : public GameUI {
         std::cout << "==========Jogo de Batalha Naval==========\n";
     }
 
-    void onGameClosed() override { std::cout << "Fim de jogo!\n"; }
+    void onGameClosed() override {
+        std::cout << "Fim de jogo!\n";
+        closed = true;
+    }
     bool isOpen() const override { return !closed; }
+    // A leitura do console já bloqueia em processInput.
+    void waitForEvents(sf::Time, bool) override {}
 
     void processInput(bool shouldReceivePlayerMove) override {
         if (!shouldReceivePlayerMove) return;
         std::string move = getPlayerMoveInput();
-        onPlayerMoveCallback(move);
+        onPlayerMoveCallback(MoveRepresentation::parseMove(
+            move, botConsoleGridView.dimension()));
     }
 
-    void onBotMove(const Position& pos) override {
+    void onBotThinking() override { std::cout << "Bot pensando...\n"; }
+
+    void onBotMove(const Position& pos, AttackOutcome outcome) override {
         std::string moveStr = MoveRepresentation::moveToStrCoordinate(pos);
-        botMoves.push_back(moveStr);
+        botMoves.push_back(moveStr + ": " + attackOutcomeToString(outcome));
     }
 
-    void onPlayerMove(const Position& pos) override {
+    void onPlayerMove(const Position& pos, AttackOutcome outcome) override {
         std::string moveStr = MoveRepresentation::moveToStrCoordinate(pos);
-        std::cout << "Você jogou em " << moveStr << "\n";
+        std::cout << "Você jogou em " << moveStr << ": "
+                  << attackOutcomeToString(outcome) << "\n";
     }
 
     void onInvalidMoveMessage() override {
@@ -0,0 +1,310 @@
+// Verificações do navalcore sem interface. Cada caso é escolhido pelo nome
+// na linha de comando (é assim que o CTest registra um teste por caso) e
+// devolve 0 se passou.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "exact_solver.hpp"
+#include "fleet_placement.hpp"
+#include "game.hpp"
+#include "game_setup.hpp"
+#include "placement_belief.hpp"
+#include "random.hpp"
+#include "tournament.hpp"
+
+static bool check(bool condition, const char* what) {
+    if (!condition) std::cerr << "Falhou: " << what << "\n";
+    return condition;
+}
+
+// Vetores de referência da Random123 para o Philox4x32-10.
+static int philoxKnownAnswers() {
+    struct Vector {
+        Philox4x32::Counter counter;
+        Philox4x32::Key key;
+        Philox4x32::Counter expected;
+    };
+    const Vector vectors[] = {
+        {{0, 0, 0, 0},
+         {0, 0},
+         {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}},
+        {{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+         {0xffffffff, 0xffffffff},
+         {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}},
+        {{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+         {0xa4093822, 0x299f31d0},
+         {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}},
+    };
+    bool ok = true;
+    for (const Vector& vector : vectors)
+        ok &= check(Philox4x32::generate(vector.counter, vector.key) ==
+                        vector.expected,
+                    "Philox4x32-10 difere do vetor de referência");
+    return ok ? 0 : 1;
+}
+
+// O fluxo (semente, índice, consumidor) é fixo: se mudar, partidas antigas
+// deixam de ser reproduzíveis.
+static int streamKnownAnswers() {
+    Random random = Random::forStream(42, 7, 2);
+    const std::uint64_t expected[] = {0xb9245c1986d91563, 0x0902d43d64f7189e,
+                                      0x0265163fe2db4348};
+    bool ok = true;
+    for (std::uint64_t value : expected)
+        ok &= check(random() == value, "Random::forStream(42, 7, 2) mudou");
+    return ok ? 0 : 1;
+}
+
+// A partida k depende só da semente e de k, não de quantas threads jogam.
+static int tournamentThreadIndependence() {
+    auto play = [](int threads) {
+        TournamentReport report =
+            Tournament({0, 40, threads, 10, 10, 6, SearchKind::Density,
+                        SearchKind::Random, 42})
+                .run();
+        std::sort(report.shotsToWin.begin(), report.shotsToWin.end());
+        return report;
+    };
+    TournamentReport single = play(1);
+    TournamentReport parallel = play(4);
+    bool ok = check(single.playerWins == 40 && single.botWins == 0,
+                    "placar da semente 42 mudou");
+    ok &= check(single.playerWins == parallel.playerWins &&
+                    single.shotsToWin == parallel.shotsToWin,
+                "resultado depende do número de threads");
+    return ok ? 0 : 1;
+}
+
+// Frota que não cabe: as partidas são descartadas em vez de derrubar o
+// processo a partir da thread do worker.
+static int tournamentInfeasibleFleet() {
+    TournamentReport report = Tournament({0, 8, 2, 10, 10, 13,
+                                          SearchKind::Random,
+                                          SearchKind::Random, 42})
+                                  .run();
+    bool ok = check(report.games + report.failedSetups == 8,
+                    "partidas sumiram do relatório");
+    ok &= check(report.failedSetups > 0, "frota de 13 navios coube em 10x10");
+    return ok ? 0 : 1;
+}
+
+static bool overlaps(const Rect& a, const Rect& b) {
+    return a.x < b.x + b.width && b.x < a.x + a.width &&
+           a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+// Cobertura esperada de uma célula: para cada tamanho, os navios ainda não
+// afundados vezes os posicionamentos legais que a cobrem. Legal é não cobrir
+// tiro na água nem a vizinhança de navio afundado, e não encostar num acerto
+// sem cobri-lo.
+static std::vector<int> expectedCoverage(const Grid& grid) {
+    int width = static_cast<int>(grid.dimension().width);
+    int height = static_cast<int>(grid.dimension().height);
+    std::vector<int> remaining(width + height + 1, 0);
+    for (int id = 0; id < grid.shipCount(); ++id)
+        if (!grid.shipBody(id).isSunk()) ++remaining[grid.shipBody(id).size];
+
+    auto isLegal = [&](const Rect& area) {
+        for (int y = area.y; y < area.y + area.height; ++y)
+            for (int x = area.x; x < area.x + area.width; ++x)
+                if (grid.isType({x, y}, CellType::AttackedWater)) return false;
+        for (int id = 0; id < grid.shipCount(); ++id) {
+            const ShipBody& body = grid.shipBody(id);
+            if (body.isSunk() && overlaps(body.area().expanded(1), area))
+                return false;
+        }
+        bool touchesHit = false;
+        grid.attackedCells().forEachSet([&](const Position& pos) {
+            if (!grid.isType(pos, CellType::AttackedWater) &&
+                !area.contains(pos) &&
+                overlaps(Rect{pos.x, pos.y, 1, 1}.expanded(1), area))
+                touchesHit = true;
+        });
+        return !touchesHit;
+    };
+
+    std::vector<int> coverage(static_cast<size_t>(width) * height, 0);
+    for (int size = 1; size < static_cast<int>(remaining.size()); ++size) {
+        if (remaining[size] == 0) continue;
+        for (Direction direction : {Direction::Right, Direction::Down}) {
+            if (size == 1 && direction == Direction::Down) break;
+            for (int y = 0; y < height; ++y)
+                for (int x = 0; x < width; ++x) {
+                    Rect area = lineRect({x, y}, direction, size);
+                    if (area.x + area.width > width ||
+                        area.y + area.height > height || !isLegal(area))
+                        continue;
+                    for (int cy = area.y; cy < area.y + area.height; ++cy)
+                        for (int cx = area.x; cx < area.x + area.width; ++cx)
+                            coverage[cy * width + cx] += remaining[size];
+                }
+        }
+    }
+    return coverage;
+}
+
+// Uma só crença acompanha várias partidas com tiros ao acaso, sincronizando
+// de tempos em tempos; a cada sync a cobertura bate com a força bruta.
+static int placementBeliefMatchesBruteForce() {
+    const int width = STANDARD_BOARD_WIDTH;
+    const int height = STANDARD_BOARD_HEIGHT;
+    PlacementBelief belief(width, height, {});
+    bool ok = true;
+    for (int gameIndex = 0; gameIndex < 200 && ok; ++gameIndex) {
+        Random random = Random::forStream(7, gameIndex, 0);
+        Game game(width, height, STANDARD_SHIPS_AMOUNT);
+        GameSetup(random).setupGame(game);
+        Grid& grid = game.state.grid(GameSide::Bot);
+        int shots = random.getInt(width * height);
+        for (int shot = 0; shot < shots && ok; ++shot) {
+            Position pos;
+            do {
+                pos = {random.getInt(width - 1), random.getInt(height - 1)};
+            } while (grid.isAttacked(pos));
+            grid.attack(pos);
+            if (random.getInt(2) != 0) continue;
+
+            belief.sync(grid);
+            std::vector<int> expected = expectedCoverage(grid);
+            for (int cell = 0; cell < width * height && ok; ++cell)
+                ok &= check(belief.coverageAt({cell % width, cell / width}) ==
+                                expected[cell],
+                            "cobertura difere da força bruta");
+        }
+    }
+    return ok ? 0 : 1;
+}
+
+// Força bruta: enumera as frotas em ordem (navios de mesmo tamanho contam
+// uma vez por permutação) e acumula quantas cobrem cada célula.
+static void countLayouts(const LayoutObservations& observations,
+                         size_t depth, const BitBoard& free,
+                         const BitBoard& occupied, double& layouts,
+                         std::vector<double>& coverage) {
+    int width = observations.width;
+    if (depth == observations.sizes.size()) {
+        for (const Position& hit : observations.hits)
+            if (!occupied.test(hit)) return;
+        layouts += 1;
+        occupied.forEachSet([&](const Position& pos) {
+            coverage[pos.y * width + pos.x] += 1;
+        });
+        return;
+    }
+    int size = observations.sizes[depth];
+    for (Direction direction : {Direction::Right, Direction::Down}) {
+        if (size == 1 && direction == Direction::Down) break;
+        for (int y = 0; y < observations.height; ++y)
+            for (int x = 0; x < width; ++x) {
+                Rect area = lineRect({x, y}, direction, size);
+                if (area.x + area.width > width ||
+                    area.y + area.height > observations.height ||
+                    free.countInRect(area) != size)
+                    continue;
+                // Um navio não afundado não pode estar todo atingido.
+                int hits = 0;
+                for (const Position& hit : observations.hits)
+                    if (area.contains(hit)) ++hits;
+                if (hits == size) continue;
+                BitBoard nextFree = free;
+                nextFree.resetRect(area.expanded(1));
+                BitBoard nextOccupied = occupied;
+                nextOccupied.setRect(area);
+                countLayouts(observations, depth + 1, nextFree, nextOccupied,
+                             layouts, coverage);
+            }
+    }
+}
+
+// trials tabuleiros, com shots tiros ao acaso em cada; quanto mais tiros,
+// menor a árvore da força bruta.
+static bool exactSolverMatchesBruteForceOn(int width, int height, int trials,
+                                           int shots) {
+    const std::vector<int> sizes = {3, 2, 2, 1};
+    // Permutações entre os dois navios de tamanho 2.
+    const double orderings = 2;
+    Random random(7);
+    bool ok = true;
+    for (int trial = 0; trial < trials && ok; ++trial) {
+        FleetPlacer placer(width, height, random);
+        auto placements = placer.place(sizes);
+        if (!placements) continue;
+        BitBoard ships(width, height);
+        for (size_t i = 0; i < sizes.size(); ++i)
+            ships.setRect(lineRect((*placements)[i].pos,
+                                   (*placements)[i].direction, sizes[i]));
+
+        LayoutObservations observations{
+            width, height, BitBoard(width, height), {}, sizes};
+        observations.freeCells.setRect({0, 0, width, height});
+        for (int shot = 0; shot < shots; ++shot) {
+            Position pos{random.getInt(width - 1), random.getInt(height - 1)};
+            bool seen = std::any_of(
+                observations.hits.begin(), observations.hits.end(),
+                [&](const Position& hit) {
+                    return hit.x == pos.x && hit.y == pos.y;
+                });
+            if (!ships.test(pos))
+                observations.freeCells.reset(pos);
+            else if (!seen)
+                observations.hits.push_back(pos);
+        }
+
+        ExactSolver solver(trial % 2 ? 3 : 1, std::uint64_t{1} << 40);
+        auto solution = solver.solve(observations);
+        double layouts = 0;
+        std::vector<double> coverage(width * height, 0);
+        countLayouts(observations, 0, observations.freeCells,
+                     BitBoard(width, height), layouts, coverage);
+
+        ok &= check(solution.has_value(), "ExactSolver desistiu");
+        if (!ok) break;
+        ok &= check(std::abs(solution->layouts - layouts / orderings) < 1e-6,
+                    "número de frotas difere da força bruta");
+        for (int cell = 0; cell < width * height; ++cell) {
+            double expected = layouts ? coverage[cell] / layouts : 0;
+            ok &= check(std::abs(solution->probability[cell] - expected) < 1e-9,
+                        "probabilidade difere da força bruta");
+        }
+        ok &= check(ExactSolver::layoutBound(observations) >=
+                        solution->layouts,
+                    "layoutBound abaixo do número de frotas");
+    }
+    return ok;
+}
+
+// O 10x10 padrão usa as máscaras compiladas; os outros tamanhos, as células.
+static int exactSolverMatchesBruteForce() {
+    bool ok = exactSolverMatchesBruteForceOn(6, 6, 20, 9);
+    ok &= exactSolverMatchesBruteForceOn(STANDARD_BOARD_WIDTH,
+                                         STANDARD_BOARD_HEIGHT, 8, 80);
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    struct Case {
+        const char* name;
+        int (*run)();
+    };
+    const Case cases[] = {
+        {"philox_known_answers", philoxKnownAnswers},
+        {"stream_known_answers", streamKnownAnswers},
+        {"tournament_thread_independence", tournamentThreadIndependence},
+        {"tournament_infeasible_fleet", tournamentInfeasibleFleet},
+        {"exact_solver_brute_force", exactSolverMatchesBruteForce},
+        {"placement_belief_brute_force", placementBeliefMatchesBruteForce},
+    };
+    if (argc != 2) {
+        std::cerr << "Uso: " << argv[0] << " <caso>\n";
+        return 2;
+    }
+    for (const Case& test : cases)
+        if (std::strcmp(argv[1], test.name) == 0) return test.run();
+    std::cerr << "Caso desconhecido: " << argv[1] << "\n";
+    return 2;
+}